@@ -0,0 +1,937 @@
+/*  crapto1-bench.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+
+    Build:
+      cc -O2 -o crapto1-bench crapto1-bench.c \
+         crapto1.c crypto1.c crypto1_bs.c -lpthread
+    Add -DCRYPTO1_BS_BITS=128 or 256 to time wider bitslices.
+
+    Usage: crapto1-bench [-m] [-b baseline] [-t percent] [bench ...]
+    Runs the named benches, or all but stress, after checking the library
+    against known answers.  -m prints tab separated name, value, unit,
+    ns/op, change against the baseline in percent and ok, regression or -.
+    Saved -m output given to -b is the baseline, a bench more than -t
+    percent (10) slower than it is a regression.  The exit status is 1 when
+    a check failed or a bench regressed.
+
+    "crapto1-bench stats" prints what a recovery32 and a darkside solve
+    went through, with crapto1.c built with -DCRAPTO1_STATS.
+
+    "crapto1-bench stress" races threads through the lazily built tables
+    and the recoveries and compares what they got, build it with
+    -fsanitize=thread -g to have ThreadSanitizer watch.
+*/
+#include "crapto1.h"
+#include "crypto1_bs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <pthread.h>
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static volatile uint32_t sink;
+
+/* options, the saved baseline and what went wrong */
+static int machine, failures, regressions;
+static double threshold = 10;
+static struct {
+	char name[48];
+	double value;
+} base[256];
+static int nbase;
+
+/** load_baseline
+ * the name and value columns of saved -m output, 0 or -1 when unreadable
+ */
+static int load_baseline(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char line[256];
+
+	if(!f)
+		return -1;
+	while(nbase < 256 && fgets(line, sizeof(line), f))
+		if(sscanf(line, "%47s %lf", base[nbase].name,
+			  &base[nbase].value) == 2)
+			++nbase;
+	fclose(f);
+	return 0;
+}
+/** report
+ * one result, with ns/op for rates and the change against the baseline,
+ * taken as better the higher a rate and the lower a time in ms
+ */
+static void report(const char *name, double value, const char *unit)
+{
+	size_t len = strlen(unit);
+	int i, rate = len > 2 && !strcmp(unit + len - 2, "/s");
+	int known = 0, slow = 0;
+	double ns = rate && value > 0 ? 1e9 / value : 0, delta = 0;
+
+	for(i = 0; i < nbase && (rate || !strcmp(unit, "ms")); ++i)
+		if(!strcmp(base[i].name, name) && base[i].value > 0 && value > 0) {
+			delta = rate ? value / base[i].value :
+				       base[i].value / value;
+			delta = (delta - 1) * 100;
+			slow = delta < -threshold;
+			known = 1;
+			break;
+		}
+	regressions += slow;
+
+	if(machine) {
+		printf("%s\t%.6g\t%s\t", name, value, unit);
+		printf(rate ? "%.6g\t" : "-\t", ns);
+		printf(known ? "%.2f\t%s\n" : "-\t-\n", delta,
+		       slow ? "regression" : "ok");
+	} else {
+		printf("%-24s %16.2f ", name, value);
+		if(rate)
+			printf("%-9s %12.1f ns/op", unit, ns);
+		else
+			printf("%s", unit);
+		if(known)
+			printf(" %+8.1f%%%s", delta, slow ? " REGRESSION" : "");
+		printf("\n");
+	}
+	fflush(stdout);
+}
+/** verify
+ * one known answer, reported as 1 pass or 0 pass
+ */
+static void verify(const char *name, int ok)
+{
+	failures += !ok;
+	report(name, ok, "pass");
+}
+/** mfkey64_key
+ * the key a state recovered from the 64 bits of ks2 and ks3 rolls back to
+ */
+static uint64_t mfkey64_key(struct Crypto1State s, uint32_t uid, uint32_t nt,
+			    uint32_t nr_enc, int words)
+{
+	uint64_t key;
+
+	while(words--)
+		lfsr_rollback_word(&s, 0, 0);
+	lfsr_rollback_word(&s, nr_enc, 1);
+	lfsr_rollback_word(&s, uid ^ nt, 0);
+	crypto1_get_lfsr(&s, &key);
+	return key;
+}
+static uint64_t state_hash(const struct Crypto1State *s, uint32_t *n)
+{
+	uint64_t h = 0;
+
+	for(*n = 0; s->odd | s->even; ++s, ++*n)
+		h += ((uint64_t)s->odd << 32 | s->even) * 0x9e3779b97f4a7c15ULL;
+	return h;
+}
+/* states handed to a crapto1_cb, in order */
+struct collect {
+	struct Crypto1State s[16];
+	size_t n;
+};
+static int collect(struct Crypto1State *s, void *arg)
+{
+	struct collect *c = arg;
+
+	if(c->n < 16)
+		c->s[c->n] = *s;
+	c->n++;
+	return 0;
+}
+/** same_states
+ * whether the collected states are the 0 terminated list
+ */
+static int same_states(const struct collect *c, const struct Crypto1State *s)
+{
+	size_t i;
+
+	for(i = 0; i < c->n && i < 16; ++i)
+		if(s[i].odd != c->s[i].odd || s[i].even != c->s[i].even)
+			return 0;
+	return c->n <= 16 && !(s[i].odd | s[i].even);
+}
+/** bench_check
+ * known answers on fixed inputs: a recorded authentication with the
+ * default key ffffffffffff, run forwards through the cipher and recovered
+ * from its keystream, the recorded darkside NACKs the darkside bench
+ * times, the bit, byte, word, batched and jumping rollbacks agreeing,
+ * and the sharded recoveries putting the whole ones back together
+ */
+static void bench_check(void)
+{
+	static const uint32_t uid = 0x9c599b32, nt = 0x82a4166c;
+	static const uint32_t nr_enc = 0xa1e458ce, ar_enc = 0x6eea41e0;
+	static const uint32_t at_enc = 0x5cadf439;
+	static uint8_t ks[8] = {0xd, 0xc, 0x8, 0x1, 0x1, 0xc, 0x2, 0x7};
+	static uint8_t par[8][8] = {
+		{0, 1, 1, 0, 0, 0, 0, 0}, {0, 1, 1, 0, 1, 0, 0, 1},
+		{0, 1, 1, 1, 0, 1, 1, 1}, {0, 1, 1, 1, 0, 0, 1, 1},
+		{0, 1, 1, 1, 0, 1, 0, 0}, {0, 1, 1, 0, 0, 0, 0, 1},
+		{0, 1, 1, 0, 1, 0, 0, 1}, {0, 1, 1, 1, 0, 1, 0, 0},
+	};
+	uint32_t ks2 = ar_enc ^ prng_successor(nt, 64);
+	uint32_t ks3 = at_enc ^ prng_successor(nt, 96);
+	uint32_t odd[64], even[64], i, n;
+	struct Crypto1State *s, *t, a, b;
+	struct collect c;
+	uint64_t key[64], k;
+	int ok, fb;
+
+	verify("check/prng_successor", prng_successor(nt, 64) == 0x8d65734b &&
+	       prng_successor(nt, 96) == 0x9a427b20 &&
+	       prng_jump(nt, 96) == 0x9a427b20);
+	verify("check/nonce_distance",
+	       nonce_distance(nt, prng_successor(nt, 1000)) == 1000 &&
+	       nonce_distance(nt, prng_successor(nt, 65534)) == 65534);
+
+	s = crypto1_create(0xffffffffffffULL);
+	ok = s && crypto1_word(s, uid ^ nt, 0) == 0xff77ff5a;
+	ok = ok && (crypto1_word(s, nr_enc, 1), 1);
+	ok = ok && crypto1_word(s, 0, 0) == ks2 && crypto1_word(s, 0, 0) == ks3;
+	verify("check/crypto1_word", ok);
+	crypto1_destroy(s);
+
+	s = lfsr_recovery32(ks2, 0);
+	ok = s && state_hash(s, &n) == 0x8874d00e354b4edcULL && n == 136804;
+	for(i = 0, t = s; ok && (t->odd | t->even); ++t)
+		i += mfkey64_key(*t, uid, nt, nr_enc, 1) == 0xffffffffffffULL;
+	verify("check/lfsr_recovery32", ok && i == 1);
+	free(s);
+
+	s = lfsr_recovery64(ks2, ks3);
+	verify("check/lfsr_recovery64", s && (s->odd | s->even) &&
+	       !(s[1].odd | s[1].even) &&
+	       mfkey64_key(*s, uid, nt, nr_enc, 2) == 0xffffffffffffULL);
+	free(s);
+
+	s = lfsr_common_prefix(0xa7c67614, 0xdcaeefb8, ks, par);
+	verify("check/lfsr_common_prefix", s && s->odd == 0x540370 &&
+	       s->even == 0x6a8a6b && !(s[1].odd | s[1].even));
+	for(c.n = 0, ok = 1, i = 0; i < 3; ++i)
+		ok &= !lfsr_common_prefix_shard(0xa7c67614, 0xdcaeefb8, ks, par,
+						i, 3, collect, &c);
+	verify("check/prefix_shard", s && ok && same_states(&c, s));
+	free(s);
+
+	s = lfsr_recovery64(ks2, ks3);
+	for(c.n = 0, ok = 1, i = 0; i < 3; ++i)
+		ok &= !lfsr_recovery64_shard(ks2, ks3, i, 3, collect, &c);
+	verify("check/recovery64_shard", s && ok && same_states(&c, s));
+	free(s);
+
+	for(ok = 1, fb = 0; fb < 2; ++fb) {
+		for(i = 0; i < 64; ++i) {
+			odd[i] = (i + 1) * 0x9e3779b9 & 0xffffff;
+			even[i] = (i + 1) * 0x85ebca6b & 0xffffff;
+		}
+		lfsr_rollback_word_batch(odd, even, 64, 0xa5c3e187, fb);
+		crypto1_get_lfsr_batch(odd, even, 64, key);
+		for(i = 0; i < 64; ++i) {
+			a.odd = b.odd = (i + 1) * 0x9e3779b9 & 0xffffff;
+			a.even = b.even = (i + 1) * 0x85ebca6b & 0xffffff;
+			lfsr_rollback_word(&a, 0xa5c3e187, fb);
+			lfsr_rollback_byte(&b, 0x87, fb);
+			lfsr_rollback_byte(&b, 0xe1, fb);
+			lfsr_rollback_byte(&b, 0xc3, fb);
+			lfsr_rollback_byte(&b, 0xa5, fb);
+			crypto1_get_lfsr(&a, &k);
+			ok &= a.odd == b.odd && a.even == b.even;
+			ok &= a.odd == odd[i] && a.even == even[i] && k == key[i];
+			lfsr_rollback_bit(&b, 0, 0);
+			lfsr_rollback_jump(&a, 1);
+			ok &= a.odd == b.odd && a.even == b.even;
+			crypto1_jump(&a, 1);
+			ok &= a.odd == odd[i] && a.even == even[i];
+		}
+	}
+	verify("check/rollback", ok);
+}
+/** bench_crypto1_bit
+ * keystream bits per second of the scalar cipher, one state
+ */
+static void bench_crypto1_bit(void)
+{
+	struct Crypto1State *s = crypto1_create(0xa0a1a2a3a4a5ULL);
+	uint32_t acc = 0, i, n = 1 << 24;
+	double t = now();
+
+	for(i = 0; i < n; ++i)
+		acc ^= crypto1_bit(s, 0, 0);
+	t = now() - t;
+
+	sink = acc;
+	crypto1_destroy(s);
+	report("crypto1_bit", n / t, "bits/s");
+}
+/** bench_crypto1_byte
+ * keystream bits per second of the table driven byte stepping, one state,
+ * and the words crypto1_word feeds in plain and encrypted
+ */
+static void bench_crypto1_byte(void)
+{
+	struct Crypto1State *s = crypto1_create(0xa0a1a2a3a4a5ULL);
+	uint8_t ks[18], par[18];
+	uint32_t acc = 0, i, n = 1 << 22;
+	double t = now();
+
+	for(i = 0; i < n; ++i)
+		acc ^= crypto1_byte(s, 0, 0);
+	t = now() - t;
+	report("crypto1_byte", 8.0 * n / t, "bits/s");
+
+	t = now();
+	for(i = 0; i < n / 18; ++i) {
+		crypto1_keystream(s, ks, par, 18);
+		acc ^= ks[17] ^ par[17];
+	}
+	t = now() - t;
+	report("crypto1_keystream/18", (double)n / 18 / t, "frames/s");
+
+	t = now();
+	for(i = 0; i < n / 4; ++i)
+		acc ^= crypto1_word(s, i, 0);
+	t = now() - t;
+	report("crypto1_word", (double)n / 4 / t, "words/s");
+
+	t = now();
+	for(i = 0; i < n / 16; ++i)
+		acc ^= crypto1_word(s, i, 1);
+	t = now() - t;
+	report("crypto1_word/encrypted", (double)n / 16 / t, "words/s");
+
+	sink = acc;
+	crypto1_destroy(s);
+}
+/** bench_crypto1_bs
+ * keystream bits per second summed over all lanes of the bitsliced cipher,
+ * and words per second through the transpose into and out of bit planes
+ */
+static void bench_crypto1_bs(void)
+{
+	static struct Crypto1BS bs;
+	static struct Crypto1State sc[CRYPTO1_BS_LANES];
+	struct Crypto1State *c, st;
+	bitslice_t ks[64], acc = BS_ZERO, planes[32], out[32];
+	uint32_t i, j, n = 1 << 14, x[CRYPTO1_BS_LANES], y[CRYPTO1_BS_LANES];
+	uint64_t key;
+	double t;
+	int l, ok;
+
+	crypto1_bs_init(&bs);
+	for(l = 0; l < CRYPTO1_BS_LANES; ++l)
+		crypto1_bs_set_key(&bs, l, 0xa0a1a2a3a4a5ULL + l);
+
+	t = now();
+	for(i = 0; i < n; ++i) {
+		crypto1_bs_keystream(&bs, ks, 64);
+		for(j = 0; j < 64; ++j)
+			acc ^= ks[j];
+	}
+	t = now() - t;
+
+	sink = BS_WORD(acc, 0);
+	report("crypto1_bs", (double)n * 64 * CRYPTO1_BS_LANES / t, "bits/s");
+
+	for(l = 0; l < CRYPTO1_BS_LANES; ++l)
+		x[l] = (l + 1) * 0x9e3779b9;
+	crypto1_bs_pack(planes, x);
+	crypto1_bs_unpack(y, planes);
+	for(ok = 1, l = 0; l < CRYPTO1_BS_LANES; ++l)
+		for(ok &= x[l] == y[l], i = 0; i < 32; ++i)
+			ok &= BS_LANE(planes[i], l) == BIT(x[l], i);
+	verify("check/crypto1_bs_pack", ok);
+
+	/* every lane against crypto1_word, plain and encrypted input in turn,
+	 * then the states they end in
+	 */
+	crypto1_bs_init(&bs);
+	for(ok = 1, l = 0; l < CRYPTO1_BS_LANES; ++l) {
+		key = 0xa0a1a2a3a4a5ULL * (l + 1) & 0xffffffffffffULL;
+		crypto1_bs_set_key(&bs, l, key);
+		if(!(c = crypto1_create(key)))
+			ok = 0;
+		else
+			sc[l] = *c;
+		crypto1_destroy(c);
+	}
+	for(j = 0; j < 4; ++j) {
+		for(l = 0; l < CRYPTO1_BS_LANES; ++l)
+			x[l] = (l + 1) * 0x9e3779b9 ^ j * 0x7f4a7c15;
+		crypto1_bs_pack(planes, x);
+		crypto1_bs_word(&bs, planes, j & 1, out);
+		crypto1_bs_unpack(y, out);
+		for(l = 0; l < CRYPTO1_BS_LANES; ++l)
+			ok &= y[l] == crypto1_word(sc + l, x[l], j & 1);
+	}
+	for(l = 0; l < CRYPTO1_BS_LANES; ++l) {
+		crypto1_bs_get(&bs, l, &st);
+		ok &= st.odd == (sc[l].odd & 0xffffff) &&
+		      st.even == (sc[l].even & 0xffffff);
+	}
+	verify("check/crypto1_bs_word", ok);
+
+	t = now();
+	for(i = 0; i < n; ++i) {
+		x[i % CRYPTO1_BS_LANES] ^= i;
+		crypto1_bs_pack(planes, x);
+		crypto1_bs_unpack(x, planes);
+	}
+	t = now() - t;
+	sink = x[0];
+	report("crypto1_bs_pack/unpack", (double)n * CRYPTO1_BS_LANES / t, "words/s");
+}
+/** bench_prng
+ * nested attack nonce prediction: the 64 nonces 1000 .. 1063 steps after
+ * each of a set of tag nonces, stepped, jumped and jumped in batches, and
+ * the distances between pairs of them
+ */
+static void bench_prng(void)
+{
+	static uint32_t nt[1 << 12], out[1 << 12];
+	uint32_t acc = 0, i, d;
+	double t;
+
+	for(nt[0] = 0x01200145, i = 1; i < 1 << 12; ++i)
+		nt[i] = prng_successor(nt[i - 1], 7919);
+
+	t = now();
+	for(i = 0; i < 1 << 12; ++i)
+		for(d = 1000; d < 1064; ++d)
+			acc ^= prng_successor(nt[i], d);
+	report("prng_successor", 64.0 * (1 << 12) / (now() - t), "nonces/s");
+
+	t = now();
+	for(i = 0; i < 1 << 12; ++i)
+		for(d = 1000; d < 1064; ++d)
+			acc ^= prng_jump(nt[i], d);
+	report("prng_jump", 64.0 * (1 << 12) / (now() - t), "nonces/s");
+
+	t = now();
+	for(d = 1000; d < 1064; ++d) {
+		prng_jump_batch(out, nt, 1 << 12, d);
+		acc ^= out[d];
+	}
+	report("prng_jump_batch", 64.0 * (1 << 12) / (now() - t), "nonces/s");
+
+	t = now();
+	for(i = 0; i < 1 << 12; ++i)
+		for(d = 1000; d < 1064; ++d)
+			acc += nonce_distance(nt[i], nt[(i + d) & 0xfff]);
+	report("nonce_distance", 64.0 * (1 << 12) / (now() - t), "pairs/s");
+	sink = acc;
+}
+/** bench_nonces
+ * valid nonces enumerated over all 256 FILTERs of FSIZE 8, walking the PRNG
+ * with FOREACH_VALID_NONCE once and from a precomputed table 256 times over,
+ * and the time to generate and to map that table
+ */
+static void bench_nonces(void)
+{
+	char path[] = "/tmp/crapto1-bench-nonces";
+	struct crapto1_nonces *t;
+	uint32_t acc = 0, f, n = 0;
+	double d;
+
+	d = now();
+	for(f = 0; f < 256; ++f) {
+		FOREACH_VALID_NONCE(N, f, 8) {
+			acc ^= N;
+			++n;
+		}
+	}
+	report("nonces/macro", n / (now() - d), "nonces/s");
+
+	unlink(path);
+	d = now();
+	t = crapto1_nonces_create(8, path);
+	report("nonces/generate", (now() - d) * 1e3, "ms");
+	crapto1_nonces_destroy(t);
+	d = now();
+	t = crapto1_nonces_create(8, path);
+	report("nonces/map", (now() - d) * 1e3, "ms");
+	if(!t)
+		return;
+
+	d = now();
+	for(n = 0, f = 0; f < 256 << 8; ++f) {
+		FOREACH_VALID_NONCE_TABLE(N, t, f) {
+			acc ^= N;
+			++n;
+		}
+	}
+	report("nonces/table", n / (now() - d), "nonces/s");
+	sink = acc;
+	crapto1_nonces_destroy(t);
+	unlink(path);
+}
+/** bench_rollback
+ * candidate to key conversion: lfsr_rollback_word and crypto1_get_lfsr per
+ * state against the batched versions, with and without feedback
+ */
+static void bench_rollback(void)
+{
+	static uint32_t odd[1 << 16], even[1 << 16];
+	static struct Crypto1State s[1 << 16];
+	static uint64_t key[1 << 16];
+	char name[40];
+	uint32_t i;
+	double t;
+	int fb;
+
+	for(fb = 0; fb < 2; ++fb) {
+		for(i = 0; i < 1 << 16; ++i) {
+			s[i].odd = odd[i] = i * 0x9e3779b9;
+			s[i].even = even[i] = i * 0x85ebca6b;
+		}
+		t = now();
+		for(i = 0; i < 1 << 16; ++i) {
+			lfsr_rollback_word(s + i, 0xa5c3e187, fb);
+			crypto1_get_lfsr(s + i, key + i);
+		}
+		snprintf(name, sizeof(name), "rollback_word/fb%d", fb);
+		report(name, (1 << 16) / (now() - t), "keys/s");
+
+		t = now();
+		lfsr_rollback_word_batch(odd, even, 1 << 16, 0xa5c3e187, fb);
+		crypto1_get_lfsr_batch(odd, even, 1 << 16, key);
+		snprintf(name, sizeof(name), "rollback_word_batch/fb%d", fb);
+		report(name, (1 << 16) / (now() - t), "keys/s");
+		sink = key[1];
+	}
+}
+/** bench_jump
+ * moving a state n clocks with crypto1_jump and lfsr_rollback_jump against
+ * n calls of crypto1_bit and lfsr_rollback_bit
+ */
+static void bench_jump(void)
+{
+	static const uint32_t dist[] = {64, 4096, 1 << 20};
+	struct Crypto1State s = {0x123456, 0xabcdef}, j = s;
+	uint32_t i, k, reps;
+	char name[40];
+	double t;
+
+	crypto1_jump(&j, 0);
+	for(k = 0; k < sizeof(dist) / sizeof(*dist); ++k) {
+		reps = (1 << 22) / dist[k];
+		t = now();
+		for(i = 0; i < reps * dist[k]; ++i)
+			crypto1_bit(&s, 0, 0);
+		snprintf(name, sizeof(name), "crypto1_bit/%u", dist[k]);
+		report(name, reps / (now() - t), "jumps/s");
+
+		t = now();
+		for(i = 0; i < reps; ++i)
+			crypto1_jump(&j, dist[k]);
+		snprintf(name, sizeof(name), "crypto1_jump/%u", dist[k]);
+		report(name, reps / (now() - t), "jumps/s");
+		snprintf(name, sizeof(name), "check/crypto1_jump/%u", dist[k]);
+		verify(name, !((s.odd ^ j.odd) & 0xffffff) &&
+			     !((s.even ^ j.even) & 0xffffff));
+
+		t = now();
+		for(i = 0; i < reps * dist[k]; ++i)
+			lfsr_rollback_bit(&s, 0, 0);
+		snprintf(name, sizeof(name), "rollback_bit/%u", dist[k]);
+		report(name, reps / (now() - t), "jumps/s");
+
+		t = now();
+		for(i = 0; i < reps; ++i)
+			lfsr_rollback_jump(&j, dist[k]);
+		snprintf(name, sizeof(name), "rollback_jump/%u", dist[k]);
+		report(name, reps / (now() - t), "jumps/s");
+		snprintf(name, sizeof(name), "check/rollback_jump/%u", dist[k]);
+		verify(name, !((s.odd ^ j.odd) & 0xffffff) &&
+			     !((s.even ^ j.even) & 0xffffff));
+	}
+	t = now();
+	crypto1_jump(&j, (1ULL << 48) - 2);
+	report("crypto1_jump/2^48-2", 1 / (now() - t), "jumps/s");
+	sink = j.odd;
+}
+/** bench_isa
+ * lfsr_recovery32 and the batched rollback with each set of kernels the cpu
+ * runs, then back to the one picked at startup
+ */
+static void bench_isa(void)
+{
+	static const char *isa[] = {"avx512", "avx2", "ssse3", "scalar"};
+	static uint32_t odd[1 << 16], even[1 << 16];
+	const char *used = crapto1_isa();
+	struct Crypto1State *sl;
+	char name[40];
+	size_t i;
+	double t;
+
+	printf("kernels in use: %s, self test %s\n", used,
+	       crapto1_selftest() ? "FAILED" : "ok");
+	for(i = 0; i < sizeof(isa) / sizeof(*isa); ++i) {
+		if(crapto1_use_isa(isa[i]))
+			continue;
+		t = now();
+		sl = lfsr_recovery32(0x12345678, 0);
+		sink = sl->odd;
+		free(sl);
+		snprintf(name, sizeof(name), "recovery32/%s", isa[i]);
+		report(name, 1 / (now() - t), "solves/s");
+
+		t = now();
+		lfsr_rollback_word_batch(odd, even, 1 << 16, 0xa5c3e187, 1);
+		snprintf(name, sizeof(name), "rollback_batch/fb1/%s", isa[i]);
+		report(name, (1 << 16) / (now() - t), "states/s");
+	}
+	crapto1_use_isa(used);
+}
+/** bench_recovery32
+ * lfsr_recovery32 and lfsr_recovery32_mt for 1, 2, 4, .. online cpus
+ */
+static void bench_recovery32(void)
+{
+	static const uint32_t ks2[] = {0x12345678, 0xdeadbeef, 0x0badf00d};
+	struct Crypto1State *sl;
+	char name[32];
+	int i, n, threads, cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	double t;
+
+	t = now();
+	for(i = 0; i < 3; ++i) {
+		sl = lfsr_recovery32(ks2[i], 0);
+		sink = sl->odd;
+		free(sl);
+	}
+	report("lfsr_recovery32", 3 / (now() - t), "solves/s");
+
+	for(threads = 1; ; threads <<= 1) {
+		n = threads < cpus ? threads : cpus;
+		t = now();
+		for(i = 0; i < 3; ++i) {
+			sl = lfsr_recovery32_mt(ks2[i], 0, n);
+			sink = sl->odd;
+			free(sl);
+		}
+		snprintf(name, sizeof(name), "lfsr_recovery32_mt/%d", n);
+		report(name, 3 / (now() - t), "solves/s");
+		if(n == cpus)
+			break;
+	}
+}
+/** bench_recovery64
+ * lfsr_recovery64 and lfsr_recovery64_mt for 1, 2, 4, .. online cpus
+ */
+static void bench_recovery64(void)
+{
+	struct Crypto1State *sl;
+	char name[32];
+	int i, n, threads, cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	double t;
+
+	t = now();
+	for(i = 0; i < 3; ++i) {
+		sl = lfsr_recovery64(0x12345678 + i, 0x9abcdef0);
+		sink = sl->odd;
+		free(sl);
+	}
+	report("lfsr_recovery64", 3 / (now() - t), "solves/s");
+
+	for(threads = 1; ; threads <<= 1) {
+		n = threads < cpus ? threads : cpus;
+		t = now();
+		for(i = 0; i < 3; ++i) {
+			sl = lfsr_recovery64_mt(0x12345678 + i, 0x9abcdef0, n);
+			sink = sl->odd;
+			free(sl);
+		}
+		snprintf(name, sizeof(name), "lfsr_recovery64_mt/%d", n);
+		report(name, 3 / (now() - t), "solves/s");
+		if(n == cpus)
+			break;
+	}
+}
+/** bench_darkside
+ * lfsr_common_prefix and lfsr_common_prefix_mt for 1, 2, 4, .. online cpus
+ * on the NACKs of one recorded darkside run
+ */
+static void bench_darkside(void)
+{
+	static uint8_t ks[8] = {0xd, 0xc, 0x8, 0x1, 0x1, 0xc, 0x2, 0x7};
+	static uint8_t par[8][8] = {
+		{0, 1, 1, 0, 0, 0, 0, 0}, {0, 1, 1, 0, 1, 0, 0, 1},
+		{0, 1, 1, 1, 0, 1, 1, 1}, {0, 1, 1, 1, 0, 0, 1, 1},
+		{0, 1, 1, 1, 0, 1, 0, 0}, {0, 1, 1, 0, 0, 0, 0, 1},
+		{0, 1, 1, 0, 1, 0, 0, 1}, {0, 1, 1, 1, 0, 1, 0, 0},
+	};
+	struct Crypto1State *sl, out[64];
+	char name[32];
+	int i, n, threads, cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	double t;
+
+	t = now();
+	for(i = 0; i < 4; ++i) {
+		sl = lfsr_common_prefix(0xa7c67614, 0xdcaeefb8, ks, par);
+		sink = sl->odd;
+		free(sl);
+	}
+	report("lfsr_common_prefix", 4 / (now() - t), "solves/s");
+
+	for(threads = 1; ; threads <<= 1) {
+		n = threads < cpus ? threads : cpus;
+		t = now();
+		for(i = 0; i < 4; ++i) {
+			lfsr_common_prefix_mt(0xa7c67614, 0xdcaeefb8, ks, par,
+					      out, 64, n);
+			sink = out->odd;
+		}
+		snprintf(name, sizeof(name), "lfsr_common_prefix_mt/%d", n);
+		report(name, 4 / (now() - t), "solves/s");
+		if(n == cpus)
+			break;
+	}
+}
+/** bench_workspace
+ * back to back lfsr_recovery32 with fresh buffers, a reused workspace and
+ * a huge page backed one
+ */
+static void bench_workspace(void)
+{
+	static const char *name[] = {"recovery32/malloc",
+		"recovery32/ws", "recovery32/ws+hugepages"};
+	struct crapto1_ws *ws = 0;
+	struct Crypto1State *sl;
+	int i, mode, n = 8;
+	double t;
+
+	for(mode = 0; mode < 3; ++mode) {
+		if(mode && !(ws = crapto1_ws_create(mode == 2 ?
+						    CRAPTO1_WS_HUGEPAGES : 0)))
+			continue;
+		t = now();
+		for(i = 0; i < n; ++i) {
+			if(ws) {
+				sl = lfsr_recovery32_ws(ws, 0x12345678 + i, 0);
+				sink = sl->odd;
+			} else {
+				sl = lfsr_recovery32(0x12345678 + i, 0);
+				sink = sl->odd;
+				free(sl);
+			}
+		}
+		report(name[mode], n / (now() - t), "solves/s");
+		crapto1_ws_destroy(ws);
+	}
+}
+/** bench_stats
+ * the counters of one lfsr_recovery32 and one darkside solve on the inputs
+ * the benches time, when crapto1.c was built with -DCRAPTO1_STATS
+ */
+static void bench_stats(void)
+{
+	static uint8_t ks[8] = {0xd, 0xc, 0x8, 0x1, 0x1, 0xc, 0x2, 0x7};
+	static uint8_t par[8][8] = {
+		{0, 1, 1, 0, 0, 0, 0, 0}, {0, 1, 1, 0, 1, 0, 0, 1},
+		{0, 1, 1, 1, 0, 1, 1, 1}, {0, 1, 1, 1, 0, 0, 1, 1},
+		{0, 1, 1, 1, 0, 1, 0, 0}, {0, 1, 1, 0, 0, 0, 0, 1},
+		{0, 1, 1, 0, 1, 0, 0, 1}, {0, 1, 1, 1, 0, 1, 0, 0},
+	};
+	struct crapto1_stats st;
+	char name[48];
+	int i, half;
+
+	if(crapto1_stats(0, 1)) {
+		printf("stats: crapto1.c built without CRAPTO1_STATS\n");
+		return;
+	}
+	free(lfsr_recovery32(0x12345678, 0));
+	crapto1_stats(&st, 1);
+	for(half = 1; half >= 0; --half)
+		for(i = 0; i < 16; ++i) {
+			snprintf(name, sizeof(name), "stats/recovery32/%s/%d",
+				 half ? "odd" : "even", i + 1);
+			report(name, st.survivors[half][i], "entries");
+		}
+	for(i = 0; i < 3; ++i) {
+		snprintf(name, sizeof(name), "stats/recovery32/joins/%d", i);
+		report(name, st.joins[i], "pairs");
+	}
+	report("stats/recovery32/candidates", st.candidates, "states");
+
+	free(lfsr_common_prefix(0xa7c67614, 0xdcaeefb8, ks, par));
+	crapto1_stats(&st, 1);
+	report("stats/common_prefix/odd", st.prefix_ks[1], "candidates");
+	report("stats/common_prefix/even", st.prefix_ks[0], "candidates");
+	report("stats/common_prefix/checked", st.pfx_checked, "states");
+	report("stats/common_prefix/rejected", st.pfx_rejected, "states");
+	report("stats/common_prefix/candidates", st.candidates, "states");
+}
+/* what one stress thread got, all of them have to agree */
+struct stress {
+	pthread_t thread;
+	uint64_t rec32, rec64, keys;
+	uint32_t dist, jump;
+	int failed;
+};
+static uint64_t stress_hash(const struct Crypto1State *s)
+{
+	uint64_t h = 0;
+
+	for(; s->odd | s->even; ++s)
+		h += ((uint64_t)s->odd << 32 | s->even) * 0x9e3779b97f4a7c15ULL;
+	return h;
+}
+/** stress_work
+ * the first use of every lazily built table, a recovery on a private
+ * workspace and one with private buffers, all racing the other threads
+ */
+static void *stress_work(void *arg)
+{
+	struct stress *st = arg;
+	struct crapto1_ws *ws = crapto1_ws_create(0);
+	struct Crypto1State *sl;
+	uint32_t odd[256], even[256], nt[256], i;
+	uint64_t key[256];
+
+	for(nt[0] = 0x01200145, i = 1; i < 256; ++i)
+		nt[i] = prng_successor(nt[i - 1], 127);
+	for(i = 0; i < 255; ++i)
+		st->dist += nonce_distance(nt[i], nt[i + 1]) != 127;
+	prng_jump_batch(nt, nt, 256, 1000);
+	for(i = 0; i < 256; ++i)
+		st->jump += nt[i] * (i + 1);
+
+	for(i = 0; i < 256; ++i) {
+		odd[i] = nt[i];
+		even[i] = ~nt[i];
+	}
+	lfsr_rollback_word_batch(odd, even, 256, 0x12345678, 0);
+	lfsr_rollback_word_batch(odd, even, 256, 0x9abcdef0, 1);
+	crypto1_get_lfsr_batch(odd, even, 256, key);
+	for(i = 0; i < 256; ++i)
+		st->keys += key[i] * (i + 1);
+
+	if(!(sl = lfsr_recovery64(0x12345678, 0x9abcdef0)))
+		goto fail;
+	st->rec64 = stress_hash(sl);
+	free(sl);
+	if(!(sl = lfsr_recovery32(0x12345678, 0xdeadbeef)))
+		goto fail;
+	st->rec32 = stress_hash(sl);
+	free(sl);
+	if(!ws || !(sl = lfsr_recovery32_ws(ws, 0x12345678, 0xdeadbeef)) ||
+	   stress_hash(sl) != st->rec32)
+		goto fail;
+	crapto1_ws_destroy(ws);
+	return 0;
+fail:
+	st->failed = 1;
+	crapto1_ws_destroy(ws);
+	return 0;
+}
+/** bench_stress
+ * several threads at once through the library from a cold start
+ */
+static void bench_stress(void)
+{
+	struct stress st[8] = {{0}};
+	int i, bad = 0, n = 8;
+	double t = now();
+
+	for(i = 0; i < n; ++i)
+		if(pthread_create(&st[i].thread, 0, stress_work, st + i))
+			break;
+	for(n = i, i = 0; i < n; ++i)
+		pthread_join(st[i].thread, 0);
+	for(i = 0; i < n; ++i)
+		bad += st[i].failed || st[i].dist || st[i].rec32 != st[0].rec32 ||
+		       st[i].rec64 != st[0].rec64 || st[i].keys != st[0].keys ||
+		       st[i].jump != st[0].jump;
+	report("stress/threads", n, "threads");
+	report("stress/mismatches", bad, "threads");
+	report("stress", n / (now() - t), "runs/s");
+}
+
+static const struct {
+	const char *name;
+	void (*run)(void);
+	int named;	/* only run when asked for by name */
+} benches[] = {
+	{ "check", bench_check, 0 },
+	{ "crypto1_bit", bench_crypto1_bit, 0 },
+	{ "crypto1_byte", bench_crypto1_byte, 0 },
+	{ "crypto1_bs", bench_crypto1_bs, 0 },
+	{ "prng", bench_prng, 0 },
+	{ "rollback", bench_rollback, 0 },
+	{ "nonces", bench_nonces, 0 },
+	{ "jump", bench_jump, 0 },
+	{ "isa", bench_isa, 0 },
+	{ "recovery32", bench_recovery32, 0 },
+	{ "recovery64", bench_recovery64, 0 },
+	{ "darkside", bench_darkside, 0 },
+	{ "workspace", bench_workspace, 0 },
+	{ "stats", bench_stats, 1 },
+	{ "stress", bench_stress, 1 },
+};
+
+int main(int argc, char *argv[])
+{
+	size_t i;
+	int c, j, run;
+
+	while((c = getopt(argc, argv, "mb:t:")) != -1) {
+		switch(c) {
+		case 'm':
+			machine = 1;
+			break;
+		case 'b':
+			if(load_baseline(optarg)) {
+				perror(optarg);
+				return 1;
+			}
+			break;
+		case 't':
+			threshold = atof(optarg);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-m] [-b baseline] "
+				"[-t percent] [bench ...]\n", argv[0]);
+			return 1;
+		}
+	}
+	for(i = 0; i < sizeof(benches) / sizeof(benches[0]); ++i) {
+		run = optind == argc && !benches[i].named;
+		run |= !strcmp(benches[i].name, "check");
+		for(j = optind; j < argc; ++j)
+			run |= !strcmp(argv[j], benches[i].name);
+		if(run)
+			benches[i].run();
+	}
+	if(failures || regressions)
+		fprintf(stderr, "%d checks failed, %d benches regressed\n",
+			failures, regressions);
+	return failures || regressions;
+}
@@ -0,0 +1,39 @@
+/*  crapto1-genlut.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+
+    Writes the bit packed filter table crapto1.c embeds, bit x & 31 of
+    word x >> 5 is filter(x).  Regenerate with:
+      cc -O2 -o crapto1-genlut crapto1-genlut.c && ./crapto1-genlut > crapto1_lut.h
+*/
+#include "crapto1.h"
+#include <stdio.h>
+
+int main(void)
+{
+	uint32_t i, j, w;
+
+	printf("/* generated by crapto1-genlut, do not edit */\n"
+	       "static const uint32_t filterlut[1 << 15] = {\n");
+	for(i = 0; i < 1 << 15; ++i) {
+		for(w = 0, j = 0; j < 32; ++j)
+			w |= (uint32_t)filter(i << 5 | j) << j;
+		printf("%s0x%08x,%s", i & 7 ? " " : "\t", w,
+		       (i & 7) == 7 ? "\n" : "");
+	}
+	printf("};\n");
+	return 0;
+}
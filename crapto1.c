@@ -18,57 +18,57 @@
     Copyright (C) 2008-2008 bla <blapost@gmail.com>
 */
 #include "crapto1.h"
+#include "crypto1_bs.h"
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-#if !defined LOWMEM && defined __GNUC__
-static uint8_t filterlut[1 << 20];
-static void __attribute__((constructor)) fill_lut()
-{
-        uint32_t i;
-        for(i = 0; i < 1 << 20; ++i)
-                filterlut[i] = filter(i);
-}
-#define filter(x) (filterlut[(x) & 0xfffff])
-#endif
-
-static void quicksort(uint32_t* const start, uint32_t* const stop)
-{
-	uint32_t *it = start + 1, *rit = stop;
-
-	if(it > rit)
-		return;
+/* growable zero terminated list of recovered states */
+struct statelist {
+	struct Crypto1State *head;
+	size_t len, size;
+};
 
-	while(it < rit)
-		if(*it <= *start)
-			++it;
-		else if(*rit > *start)
-			--rit;
-		else
-			*it ^= (*it ^= *rit, *rit ^= *it);
-
-	if(*rit >= *start)
-		--rit;
-	if(rit != start)
-		*rit ^= (*rit ^= *start, *start ^= *rit);
+#ifndef LOWMEM
+/* filter() of every 20 bit input, one bit each, from crapto1-genlut */
+#include "crapto1_lut.h"
+#define filter(x) (filterlut[(x) >> 5 & 0x7fff] >> ((x) & 31) & 1)
+/* filter(x) and filter(x | 1) in bits 0 and 1, x even, in one load */
+#define filter2(x) (filterlut[(x) >> 5 & 0x7fff] >> ((x) & 30) & 3)
+#else
+#define filter2(x) (filter(x) | filter((x) | 1) << 1)
+#endif
 
-	quicksort(start, rit - 1);
-	quicksort(rit + 1, stop);
-}
-/** binsearch
- * Binary search for the first occurence of *stop's MSB in sorted [start,stop]
+/** bucket_sort
+ * in place radix partition of [head, tail] on the contribution byte in the
+ * MSB, afterwards bucket[b] up to bucket[b + 1] holds the entries with MSB b
  */
-static inline uint32_t* binsearch(uint32_t *start, uint32_t *stop)
+static void bucket_sort(uint32_t *head, uint32_t *tail, uint32_t *bucket[257])
 {
-	uint32_t mid, val = *stop & 0xff000000;
-	while(start != stop)
-		if(start[mid = (stop - start) >> 1] > val)
-			stop = &start[mid];
-		else
-			start += mid + 1;
+	uint32_t *next[256], *it, v, t, d, b;
+	uint32_t count[256] = {0};
 
-	return start;
-}
+	for(it = head; it <= tail; ++it)
+		++count[*it >> 24];
+	for(bucket[0] = head, b = 0; b < 256; ++b)
+		bucket[b + 1] = (next[b] = bucket[b]) + count[b];
 
+	for(b = 0; b < 256; ++b)
+		while(next[b] < bucket[b + 1]) {
+			v = *next[b];
+			for(d = v >> 24; d != b; d = v >> 24) {
+				t = *next[d];
+				*next[d]++ = v;
+				v = t;
+			}
+			*next[b]++ = v;
+		}
+}
 /** update_contribution
  * helper, calculates the partial linear feedback contributions and puts in MSB
  */
@@ -88,13 +88,16 @@ update_contribution(uint32_t *item, const uint32_t mask1, const uint32_t mask2)
 static inline void
 extend_table(uint32_t *tbl, uint32_t **end, int bit, int m1, int m2, uint32_t in)
 {
+	uint32_t f;
+
 	in <<= 24;
-	for(*tbl <<= 1; tbl <= *end; *++tbl <<= 1)
-		if(filter(*tbl) ^ filter(*tbl | 1)) {
-			*tbl |= filter(*tbl) ^ bit;
+	for(*tbl <<= 1; tbl <= *end; *++tbl <<= 1) {
+		f = filter2(*tbl);
+		if((f ^ f >> 1) & 1) {
+			*tbl |= (f & 1) ^ bit;
 			update_contribution(tbl, m1, m2);
 			*tbl ^= in;
-		} else if(filter(*tbl) == bit) {
+		} else if((f & 1) == (uint32_t)bit) {
 			*++*end = tbl[1];
 			tbl[1] = tbl[0] | 1;
 			update_contribution(tbl, m1, m2);
@@ -103,41 +106,379 @@ extend_table(uint32_t *tbl, uint32_t **end, int bit, int m1, int m2, uint32_t in
 			*tbl ^= in;
 		} else
 			*tbl-- = *(*end)--;
+	}
 }
 /** extend_table_simple
  * using a bit of the keystream extend the table of possible lfsr states
  */
 static inline void extend_table_simple(uint32_t *tbl, uint32_t **end, int bit)
 {
-	for(*tbl <<= 1; tbl <= *end; *++tbl <<= 1)
-		if(filter(*tbl) ^ filter(*tbl | 1))
-			*tbl |= filter(*tbl) ^ bit;
-		else if(filter(*tbl) == bit) {
+	uint32_t f;
+
+	for(*tbl <<= 1; tbl <= *end; *++tbl <<= 1) {
+		f = filter2(*tbl);
+		if((f ^ f >> 1) & 1)
+			*tbl |= (f & 1) ^ bit;
+		else if((f & 1) == (uint32_t)bit) {
 			*++*end = *++tbl;
 			*tbl = tbl[-1] | 1;
 		} else
 			*tbl-- = *(*end)--;
+	}
+}
+/** extend_emit
+ * scalar extend_table(_simple without masks) of one entry into dst
+ */
+static inline size_t extend_emit(uint32_t *dst, uint32_t x, int bit,
+				 uint32_t m1, uint32_t m2, uint32_t in)
+{
+	uint32_t f, n = 0;
+
+	x <<= 1;
+	f = filter2(x);
+	if((f ^ f >> 1) & 1)
+		dst[n++] = x | ((f & 1) ^ bit);
+	else if((f & 1) == (uint32_t)bit) {
+		dst[n++] = x;
+		dst[n++] = x | 1;
+	}
+	if(m1)
+		for(f = 0; f < n; ++f) {
+			update_contribution(dst + f, m1, m2);
+			dst[f] ^= in;
+		}
+	return n;
+}
+
+/* The kernels for the big tables of recovery32_side and the batched
+ * rollback, built for every instruction set the compiler knows and picked
+ * at run time, see crapto1_isa.
+ */
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+#define CRAPTO1_X86
+#include <immintrin.h>
+/* indices of the set bits of the mask, a nibble each */
+static const uint32_t compress_idx8[256] = {
+	0x00000000, 0x00000000, 0x00000001, 0x00000010, 0x00000002, 0x00000020, 0x00000021, 0x00000210,
+	0x00000003, 0x00000030, 0x00000031, 0x00000310, 0x00000032, 0x00000320, 0x00000321, 0x00003210,
+	0x00000004, 0x00000040, 0x00000041, 0x00000410, 0x00000042, 0x00000420, 0x00000421, 0x00004210,
+	0x00000043, 0x00000430, 0x00000431, 0x00004310, 0x00000432, 0x00004320, 0x00004321, 0x00043210,
+	0x00000005, 0x00000050, 0x00000051, 0x00000510, 0x00000052, 0x00000520, 0x00000521, 0x00005210,
+	0x00000053, 0x00000530, 0x00000531, 0x00005310, 0x00000532, 0x00005320, 0x00005321, 0x00053210,
+	0x00000054, 0x00000540, 0x00000541, 0x00005410, 0x00000542, 0x00005420, 0x00005421, 0x00054210,
+	0x00000543, 0x00005430, 0x00005431, 0x00054310, 0x00005432, 0x00054320, 0x00054321, 0x00543210,
+	0x00000006, 0x00000060, 0x00000061, 0x00000610, 0x00000062, 0x00000620, 0x00000621, 0x00006210,
+	0x00000063, 0x00000630, 0x00000631, 0x00006310, 0x00000632, 0x00006320, 0x00006321, 0x00063210,
+	0x00000064, 0x00000640, 0x00000641, 0x00006410, 0x00000642, 0x00006420, 0x00006421, 0x00064210,
+	0x00000643, 0x00006430, 0x00006431, 0x00064310, 0x00006432, 0x00064320, 0x00064321, 0x00643210,
+	0x00000065, 0x00000650, 0x00000651, 0x00006510, 0x00000652, 0x00006520, 0x00006521, 0x00065210,
+	0x00000653, 0x00006530, 0x00006531, 0x00065310, 0x00006532, 0x00065320, 0x00065321, 0x00653210,
+	0x00000654, 0x00006540, 0x00006541, 0x00065410, 0x00006542, 0x00065420, 0x00065421, 0x00654210,
+	0x00006543, 0x00065430, 0x00065431, 0x00654310, 0x00065432, 0x00654320, 0x00654321, 0x06543210,
+	0x00000007, 0x00000070, 0x00000071, 0x00000710, 0x00000072, 0x00000720, 0x00000721, 0x00007210,
+	0x00000073, 0x00000730, 0x00000731, 0x00007310, 0x00000732, 0x00007320, 0x00007321, 0x00073210,
+	0x00000074, 0x00000740, 0x00000741, 0x00007410, 0x00000742, 0x00007420, 0x00007421, 0x00074210,
+	0x00000743, 0x00007430, 0x00007431, 0x00074310, 0x00007432, 0x00074320, 0x00074321, 0x00743210,
+	0x00000075, 0x00000750, 0x00000751, 0x00007510, 0x00000752, 0x00007520, 0x00007521, 0x00075210,
+	0x00000753, 0x00007530, 0x00007531, 0x00075310, 0x00007532, 0x00075320, 0x00075321, 0x00753210,
+	0x00000754, 0x00007540, 0x00007541, 0x00075410, 0x00007542, 0x00075420, 0x00075421, 0x00754210,
+	0x00007543, 0x00075430, 0x00075431, 0x00754310, 0x00075432, 0x00754320, 0x00754321, 0x07543210,
+	0x00000076, 0x00000760, 0x00000761, 0x00007610, 0x00000762, 0x00007620, 0x00007621, 0x00076210,
+	0x00000763, 0x00007630, 0x00007631, 0x00076310, 0x00007632, 0x00076320, 0x00076321, 0x00763210,
+	0x00000764, 0x00007640, 0x00007641, 0x00076410, 0x00007642, 0x00076420, 0x00076421, 0x00764210,
+	0x00007643, 0x00076430, 0x00076431, 0x00764310, 0x00076432, 0x00764320, 0x00764321, 0x07643210,
+	0x00000765, 0x00007650, 0x00007651, 0x00076510, 0x00007652, 0x00076520, 0x00076521, 0x00765210,
+	0x00007653, 0x00076530, 0x00076531, 0x00765310, 0x00076532, 0x00765320, 0x00765321, 0x07653210,
+	0x00007654, 0x00076540, 0x00076541, 0x00765410, 0x00076542, 0x00765420, 0x00765421, 0x07654210,
+	0x00076543, 0x00765430, 0x00765431, 0x07654310, 0x00765432, 0x07654320, 0x07654321, 0x76543210,
+};
+/* pshufb masks moving the lanes of the set bits of the mask to the front */
+static const uint8_t compress_idx4[16][16] = {
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0, 1, 2, 3, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{4, 5, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0, 1, 2, 3, 4, 5, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{8, 9, 10, 11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0, 1, 2, 3, 8, 9, 10, 11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{4, 5, 6, 7, 8, 9, 10, 11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0x80, 0x80, 0x80, 0x80},
+	{12, 13, 14, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0, 1, 2, 3, 12, 13, 14, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{4, 5, 6, 7, 12, 13, 14, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15, 0x80, 0x80, 0x80, 0x80},
+	{8, 9, 10, 11, 12, 13, 14, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15, 0x80, 0x80, 0x80, 0x80},
+	{4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0x80, 0x80, 0x80, 0x80},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+};
+
+#define CRAPTO1_ISA 3
+#define ISA avx512
+#include "crapto1_simd.h"
+#undef CRAPTO1_ISA
+#undef ISA
+#define CRAPTO1_ISA 2
+#define ISA avx2
+#include "crapto1_simd.h"
+#undef CRAPTO1_ISA
+#undef ISA
+#define CRAPTO1_ISA 1
+#define ISA ssse3
+#include "crapto1_simd.h"
+#undef CRAPTO1_ISA
+#undef ISA
+
+static int cpu_avx512(void)
+{
+	return __builtin_cpu_supports("avx512f");
+}
+static int cpu_avx2(void)
+{
+	return __builtin_cpu_supports("avx2");
+}
+static int cpu_ssse3(void)
+{
+	return __builtin_cpu_supports("ssse3");
+}
+#endif
+#define CRAPTO1_ISA 0
+#define ISA scalar
+#include "crapto1_simd.h"
+#undef CRAPTO1_ISA
+#undef ISA
+/* the most the vector kernels write past their output */
+#define VLANES_MAX 16
+
+struct isa {
+	const char *name;
+	int (*supported)(void);
+	size_t (*extend_copy)(const uint32_t *src, size_t n, uint32_t *dst,
+			      int bit, uint32_t m1, uint32_t m2, uint32_t in);
+	size_t (*filter_scan)(uint32_t *dst, int bit);
+	void (*rollback_bit_batch)(uint32_t *odd, uint32_t *even, size_t n,
+				   uint32_t in);
+};
+/* best first, the scalar code last */
+static const struct isa isas[] = {
+#ifdef CRAPTO1_X86
+	{"avx512", cpu_avx512, extend_copy_avx512, filter_scan_avx512,
+	 rollback_bit_batch_avx512},
+	{"avx2", cpu_avx2, extend_copy_avx2, filter_scan_avx2,
+	 rollback_bit_batch_avx2},
+	{"ssse3", cpu_ssse3, extend_copy_ssse3, filter_scan_ssse3,
+	 rollback_bit_batch_ssse3},
+#endif
+	{"scalar", 0, extend_copy_scalar, filter_scan_scalar,
+	 rollback_bit_batch_scalar},
+};
+#define NISAS (sizeof(isas) / sizeof(*isas))
+static const struct isa *isa_used;
+static pthread_once_t isa_once = PTHREAD_ONCE_INIT;
+
+static int u32_cmp(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+	return x < y ? -1 : x > y;
+}
+/** isa_check
+ * whether the kernels of v give the same results as the scalar ones, the
+ * table extension compared as sets
+ */
+static int isa_check(const struct isa *v)
+{
+	const struct isa *ref = isas + NISAS - 1;
+	size_t n = (1 << 20) + VLANES_MAX + 1, i, len[2];
+	uint32_t *a = malloc(sizeof(*a) * n), *b = malloc(sizeof(*b) * n);
+	uint32_t x = 0x2545f491;
+	int bit, ok = a && b;
+
+	for(bit = 0; ok && bit < 2; ++bit) {
+		len[0] = ref->filter_scan(a, bit);
+		len[1] = v->filter_scan(b, bit);
+		ok = len[0] == len[1] && !memcmp(a, b, len[0] * sizeof(*a));
+	}
+	for(bit = 0; ok && bit < 4; ++bit) {
+		/* 4096 entries of 24 bits at the top of a and b, out below */
+		for(i = 0; i < 4096; ++i) {
+			x ^= x << 13, x ^= x >> 17, x ^= x << 5;
+			a[n - 4096 + i] = b[n - 4096 + i] = x & 0xffffff;
+		}
+		len[0] = ref->extend_copy(a + n - 4096, 4096, a, bit & 1,
+					  bit & 2 ? LF_POLY_ODD : 0,
+					  LF_POLY_EVEN << 1 | 1, 3);
+		len[1] = v->extend_copy(b + n - 4096, 4096, b, bit & 1,
+					bit & 2 ? LF_POLY_ODD : 0,
+					LF_POLY_EVEN << 1 | 1, 3);
+		qsort(a, len[0], sizeof(*a), u32_cmp);
+		qsort(b, len[1], sizeof(*b), u32_cmp);
+		ok = len[0] == len[1] && !memcmp(a, b, len[0] * sizeof(*a));
+	}
+	for(bit = 0; ok && bit < 2; ++bit) {
+		for(i = 0; i < 8192; ++i) {
+			x ^= x << 13, x ^= x >> 17, x ^= x << 5;
+			a[i] = b[i] = x & 0xffffff;
+		}
+		ref->rollback_bit_batch(a, a + 4096, 4096, bit);
+		v->rollback_bit_batch(b, b + 4096, 4096, bit);
+		ok = !memcmp(a, b, 8192 * sizeof(*a));
+	}
+	free(a);
+	free(b);
+	return ok;
+}
+static int isa_usable(const struct isa *v)
+{
+	return !v->supported || (v->supported() && isa_check(v));
+}
+/** isa_init
+ * the kernels named by CRAPTO1_ISA in the environment, else the best ones
+ * the cpu runs that pass the self test
+ */
+static void isa_init(void)
+{
+	const char *name = getenv("CRAPTO1_ISA");
+	size_t i;
+
+	for(i = 0; name && i < NISAS; ++i)
+		if(!strcmp(isas[i].name, name) && isa_usable(isas + i)) {
+			isa_used = isas + i;
+			return;
+		}
+	for(i = 0; !isa_usable(isas + i); ++i);
+	isa_used = isas + i;
+}
+static const struct isa *kernels(void)
+{
+	pthread_once(&isa_once, isa_init);
+	return __atomic_load_n(&isa_used, __ATOMIC_ACQUIRE);
+}
+/** crapto1_isa
+ * the name of the kernels in use
+ */
+const char *crapto1_isa(void)
+{
+	return kernels()->name;
+}
+/** crapto1_use_isa
+ * switch to the kernels of the given name, -1 when the cpu does not run
+ * them or they fail the self test
+ */
+int crapto1_use_isa(const char *name)
+{
+	size_t i;
+
+	kernels();
+	for(i = 0; i < NISAS; ++i)
+		if(!strcmp(isas[i].name, name) && isa_usable(isas + i)) {
+			__atomic_store_n(&isa_used, isas + i, __ATOMIC_RELEASE);
+			return 0;
+		}
+	return -1;
+}
+/** crapto1_selftest
+ * compare the kernels of every instruction set the cpu runs with the
+ * scalar ones, -1 when any of them differs
+ */
+int crapto1_selftest(void)
+{
+	size_t i;
+
+	for(i = 0; i < NISAS; ++i)
+		if(isas[i].supported && isas[i].supported() &&
+		   !isa_check(isas + i))
+			return -1;
+	return 0;
+}
+
+#ifdef CRAPTO1_STATS
+static __thread struct crapto1_stats stats;
+#define STAT(x) ((void)(x))
+
+static void stats_add(struct crapto1_stats *to, const struct crapto1_stats *from)
+{
+	uint64_t *t = (uint64_t *)to;
+	const uint64_t *f = (const uint64_t *)from;
+	size_t i;
+
+	for(i = 0; i < sizeof(*to) / sizeof(*t); ++i)
+		t[i] += f[i];
+}
+#else
+#define STAT(x) ((void)0)
+#endif
+/** crapto1_stats
+ * copy the counters of the calling thread to out, when not 0, and zero them
+ * when reset is set.  Returns -1, out zeroed, when they are not compiled in.
+ */
+int crapto1_stats(struct crapto1_stats *out, int reset)
+{
+#ifdef CRAPTO1_STATS
+	if(out)
+		*out = stats;
+	if(reset)
+		memset(&stats, 0, sizeof(stats));
+	return 0;
+#else
+	(void)reset;
+	if(out)
+		memset(out, 0, sizeof(*out));
+	return -1;
+#endif
+}
+/** statelist_add
+ * callback appending a state to a growable, zero terminated statelist
+ */
+static int statelist_add(struct Crypto1State *s, void *arg)
+{
+	struct statelist *sl = arg;
+	struct Crypto1State *head;
+
+	if(sl->len + 1 >= sl->size) {
+		head = realloc(sl->head, sizeof(*head) * (sl->size << 1));
+		if(!head)
+			return -1;
+		sl->head = head;
+		sl->size <<= 1;
+	}
+	sl->head[sl->len++] = *s;
+	sl->head[sl->len].odd = sl->head[sl->len].even = 0;
+	return 0;
+}
+static int statelist_init(struct statelist *sl, size_t size)
+{
+	sl->len = 0;
+	sl->size = size;
+	sl->head = malloc(sizeof(*sl->head) * size);
+	if(!sl->head)
+		return -1;
+	sl->head->odd = sl->head->even = 0;
+	return 0;
 }
 /** recover
  * recursively narrow down the search space, 4 bits of keystream at a time
  */
-static struct Crypto1State*
+static int
 recover(uint32_t *o_head, uint32_t *o_tail, uint32_t oks,
 	uint32_t *e_head, uint32_t *e_tail, uint32_t eks, int rem,
-	struct Crypto1State *sl, uint32_t in)
+	uint32_t in, crapto1_cb cb, void *arg)
 {
-	uint32_t *o, *e, i;
+	uint32_t *o, *e, *o_bucket[257], *e_bucket[257], i;
+	struct Crypto1State s;
+	int ret;
 
 	if(rem == -1) {
 		for(e = e_head; e <= e_tail; ++e) {
 			*e = *e << 1 ^ parity(*e & LF_POLY_EVEN) ^ !!(in & 4);
-			for(o = o_head; o <= o_tail; ++o, ++sl) {
-				sl->even = *o;
-				sl->odd = *e ^ parity(*o & LF_POLY_ODD);
-				sl[1].odd = sl[1].even = 0;
+			for(o = o_head; o <= o_tail; ++o) {
+				s.even = *o;
+				s.odd = *e ^ parity(*o & LF_POLY_ODD);
+				STAT(++stats.candidates);
+				if((ret = cb(&s, arg)))
+					return ret;
 			}
 		}
-		return sl;
+		return 0;
 	}
 
 	for(i = 0; i < 4 && rem--; i++) {
@@ -146,31 +487,168 @@ recover(uint32_t *o_head, uint32_t *o_tail, uint32_t oks,
 		in >>= 2;
 		extend_table(o_head, &o_tail, oks & 1, LF_POLY_EVEN << 1 | 1,
 			     LF_POLY_ODD << 1, 0);
+		STAT(stats.survivors[1][15 - rem] += o_tail + 1 - o_head);
 		if(o_head > o_tail)
-			return sl;
+			return 0;
 
 		extend_table(e_head, &e_tail, eks & 1, LF_POLY_ODD,
 			     LF_POLY_EVEN << 1 | 1, in & 3);
+		STAT(stats.survivors[0][15 - rem] += e_tail + 1 - e_head);
 		if(e_head > e_tail)
-			return sl;
+			return 0;
 	}
 
-	quicksort(o_head, o_tail);
-	quicksort(e_head, e_tail);
+	bucket_sort(o_head, o_tail, o_bucket);
+	bucket_sort(e_head, e_tail, e_bucket);
 
-	while(o_tail >= o_head && e_tail >= e_head)
-		if(((*o_tail ^ *e_tail) >> 24) == 0) {
-			o_tail = binsearch(o_head, o = o_tail);
-			e_tail = binsearch(e_head, e = e_tail);
-			sl = recover(o_tail--, o, oks,
-				     e_tail--, e, eks, rem, sl, in);
-		}
-		else if(*o_tail > *e_tail)
-			o_tail = binsearch(o_head, o_tail) - 1;
+	for(i = 256; i--;) {
+		if(o_bucket[i] == o_bucket[i + 1] || e_bucket[i] == e_bucket[i + 1])
+			continue;
+		STAT(++stats.joins[rem < 0 ? 2 : 1]);
+		if((ret = recover(o_bucket[i], o_bucket[i + 1] - 1, oks,
+				  e_bucket[i], e_bucket[i + 1] - 1, eks,
+				  rem, in, cb, arg)))
+			return ret;
+	}
+
+	return 0;
+}
+/* one half of the lfsr being narrowed down by lfsr_recovery32 */
+struct recovery32_side {
+	pthread_t thread;
+	uint32_t *head, *tail, *bucket[257], ks, in;
+	int isodd, rounds;
+#ifdef CRAPTO1_STATS
+	uint64_t survivors[9];
+#endif
+};
+/** extend_side
+ * extend the n entries of a 1 << 21 entry table the way extend_table does,
+ * or extend_table_simple with m1 0, returns the new number of entries
+ */
+static size_t extend_side(uint32_t *head, size_t n, int bit,
+			  uint32_t m1, uint32_t m2, uint32_t in)
+{
+	uint32_t *tail = head + n - 1;
+
+	if(n + VLANES_MAX <= 1 << 20) {
+		/* moved out of the way of the survivors, which at most double */
+		memmove(head + (1 << 21) - n, head, n * sizeof(*head));
+		return kernels()->extend_copy(head + (1 << 21) - n, n, head,
+					      bit, m1, m2, in);
+	}
+	if(m1)
+		extend_table(head, &tail, bit, m1, m2, in);
+	else
+		extend_table_simple(head, &tail, bit);
+	return tail + 1 - head;
+}
+/** recovery32_side
+ * fill the table with the states matching the first 5 bits of its half of
+ * the keystream, then extend it by rounds more bits the way recover does
+ * and partition it when it is going to be joined
+ */
+static void *recovery32_side(void *arg)
+{
+	struct recovery32_side *s = arg;
+	size_t n;
+	int i;
+
+	n = kernels()->filter_scan(s->head, s->ks & 1);
+	STAT(s->survivors[0] = n);
+	for(i = 0; i < 4; i++) {
+		n = extend_side(s->head, n, (s->ks >>= 1) & 1, 0, 0, 0);
+		STAT(s->survivors[1 + i] = n);
+	}
+
+	for(i = 0; n && i < s->rounds; i++) {
+		s->ks >>= 1;
+		s->in >>= 2;
+		if(s->isodd)
+			n = extend_side(s->head, n, s->ks & 1,
+					LF_POLY_EVEN << 1 | 1, LF_POLY_ODD << 1, 0);
 		else
-			e_tail = binsearch(e_head, e_tail) - 1;
+			n = extend_side(s->head, n, s->ks & 1, LF_POLY_ODD,
+					LF_POLY_EVEN << 1 | 1, s->in & 3);
+		STAT(s->survivors[5 + i] = n);
+	}
+	s->tail = s->head + n - 1;
+	if(s->rounds)
+		bucket_sort(s->head, s->tail, s->bucket);
+	return 0;
+}
+#ifdef CRAPTO1_STATS
+static void stats_side(const struct recovery32_side *s)
+{
+	int i;
+
+	for(i = 0; i < 9; ++i)
+		stats.survivors[s->isodd][i] += s->survivors[i];
+}
+#endif
+static void recovery32_init(struct recovery32_side *odd,
+			    struct recovery32_side *even, uint32_t ks2, uint32_t in)
+{
+	int i;
+
+	for(odd->ks = 0, i = 31; i >= 0; i -= 2)
+		odd->ks = odd->ks << 1 | BEBIT(ks2, i);
+	for(even->ks = 0, i = 30; i >= 0; i -= 2)
+		even->ks = even->ks << 1 | BEBIT(ks2, i);
+
+	odd->isodd = 1;
+	even->isodd = 0;
+	odd->in = 0;
+	even->in = ((in >> 16 & 0xff) | (in << 16) | (in & 0xff00)) << 1;
+}
+/** recovery32
+ * lfsr_recovery32_cb on caller supplied tables of 1 << 21 entries each
+ */
+static int recovery32(uint32_t *odd_head, uint32_t *even_head,
+		      uint32_t ks2, uint32_t in, crapto1_cb cb, void *arg)
+{
+	struct recovery32_side odd = {0}, even = {0};
+	int i, ret;
+
+	odd.head = odd_head;
+	even.head = even_head;
+	recovery32_init(&odd, &even, ks2, in);
+	odd.rounds = even.rounds = 4;
+	recovery32_side(&odd);
+	recovery32_side(&even);
+	STAT(stats_side(&odd));
+	STAT(stats_side(&even));
+
+	for(i = 256; i--;) {
+		if(odd.bucket[i] == odd.bucket[i + 1] ||
+		   even.bucket[i] == even.bucket[i + 1])
+			continue;
+		STAT(++stats.joins[0]);
+		if((ret = recover(odd.bucket[i], odd.bucket[i + 1] - 1, odd.ks,
+				  even.bucket[i], even.bucket[i + 1] - 1,
+				  even.ks, 7, even.in, cb, arg)))
+			return ret;
+	}
+	return 0;
+}
+/** lfsr_recovery32_cb
+ * lfsr_recovery32 handing each candidate state to cb as soon as it is found,
+ * cb may modify the state and stops the recovery by returning non zero.
+ * Returns what cb returned to stop, 0 when done or -1 when out of memory.
+ */
+int lfsr_recovery32_cb(uint32_t ks2, uint32_t in, crapto1_cb cb, void *arg)
+{
+	uint32_t *odd, *even;
+	int ret = -1;
 
-	return sl;
+	odd = malloc(sizeof(uint32_t) << 21);
+	even = malloc(sizeof(uint32_t) << 21);
+	if(odd && even)
+		ret = recovery32(odd, even, ks2, in, cb, arg);
+
+	free(odd);
+	free(even);
+	return ret;
 }
 /** lfsr_recovery
  * recover the state of the lfsr given 32 bits of the keystream
@@ -179,46 +657,263 @@ recover(uint32_t *o_head, uint32_t *o_tail, uint32_t oks,
  */
 struct Crypto1State* lfsr_recovery32(uint32_t ks2, uint32_t in)
 {
-	struct Crypto1State *statelist;
-	uint32_t *odd_head = 0, *odd_tail = 0, oks = 0;
-	uint32_t *even_head = 0, *even_tail = 0, eks = 0;
-	int i;
+	struct statelist sl;
 
-	for(i = 31; i >= 0; i -= 2)
-		oks = oks << 1 | BEBIT(ks2, i);
-	for(i = 30; i >= 0; i -= 2)
-		eks = eks << 1 | BEBIT(ks2, i);
-
-	odd_head = odd_tail = malloc(sizeof(uint32_t) << 21);
-	even_head = even_tail = malloc(sizeof(uint32_t) << 21);
-	statelist =  malloc(sizeof(struct Crypto1State) << 18);
-	if(!odd_tail-- || !even_tail-- || !statelist) {
-		free(statelist);
-		statelist = 0;
-		goto out;
+	if(statelist_init(&sl, 1 << 12))
+		return 0;
+	if(lfsr_recovery32_cb(ks2, in, statelist_add, &sl)) {
+		free(sl.head);
+		return 0;
 	}
+	return sl.head;
+}
+
+/* where the states of one piece of parallel work ended up */
+struct segment {
+	size_t worker, first, len;
+};
+struct worker {
+	pthread_t thread;
+	struct pool *pool;
+	struct statelist sl;
+	size_t id;
+#ifdef CRAPTO1_STATS
+	struct crapto1_stats stats;
+#endif
+};
+/* threads claiming ntasks pieces of work through an atomic cursor */
+struct pool {
+	struct worker *workers;
+	size_t n, ntasks, next;
+	int failed;
+	void *job;
+	void *(*fn)(void *);
+};
+
+static int nthreads(int threads)
+{
+	long n = threads;
 
-	statelist->odd = statelist->even = 0;
+	if(n <= 0)
+		n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n < 1 ? 1 : n;
+}
+/** pool_claim
+ * hand out the next task, 0 once all are taken or a worker failed
+ */
+static int pool_claim(struct worker *w, size_t *task)
+{
+	struct pool *pool = w->pool;
 
-	for(i = 1 << 20; i >= 0; --i) {
-		if(filter(i) == (oks & 1))
-			*++odd_tail = i;
-		if(filter(i) == (eks & 1))
-			*++even_tail = i;
+	if(__atomic_load_n(&pool->failed, __ATOMIC_RELAXED))
+		return 0;
+	*task = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED);
+	return *task < pool->ntasks;
+}
+static void pool_fail(struct pool *pool)
+{
+	__atomic_store_n(&pool->failed, 1, __ATOMIC_RELAXED);
+}
+/** pool_thread
+ * run the job on a worker, keeping what the thread counted for pool_run
+ */
+static void *pool_thread(void *arg)
+{
+	struct worker *w = arg;
+
+	w->pool->fn(w);
+#ifdef CRAPTO1_STATS
+	w->stats = stats;
+#endif
+	return 0;
+}
+/** pool_run
+ * run fn on up to threads workers (0 for one per online cpu) until the
+ * ntasks are done, each worker collecting states in its own list
+ */
+static int pool_run(struct pool *pool, int threads, size_t ntasks,
+		    void *(*fn)(void *))
+{
+	size_t i, n = nthreads(threads);
+
+	if(n > ntasks)
+		n = ntasks ? ntasks : 1;
+	pool->ntasks = ntasks;
+	pool->next = 0;
+	pool->failed = 0;
+	pool->fn = fn;
+	pool->workers = calloc(n, sizeof(*pool->workers));
+	if(!pool->workers)
+		return -1;
+
+	for(i = 0; i < n; ++i) {
+		pool->workers[i].pool = pool;
+		pool->workers[i].id = i;
+		if(statelist_init(&pool->workers[i].sl, 1 << 12) ||
+		   pthread_create(&pool->workers[i].thread, 0, pool_thread,
+				  pool->workers + i)) {
+			free(pool->workers[i].sl.head);
+			pool_fail(pool);
+			break;
+		}
+	}
+	pool->n = i;
+	for(i = 0; i < pool->n; ++i) {
+		pthread_join(pool->workers[i].thread, 0);
+		STAT(stats_add(&stats, &pool->workers[i].stats));
 	}
 
-	for(i = 0; i < 4; i++) {
-		extend_table_simple(odd_head,  &odd_tail, (oks >>= 1) & 1);
-		extend_table_simple(even_head, &even_tail, (eks >>= 1) & 1);
+	return pool->failed ? -1 : 0;
+}
+static void pool_free(struct pool *pool)
+{
+	size_t i;
+
+	for(i = 0; pool->workers && i < pool->n; ++i)
+		free(pool->workers[i].sl.head);
+	free(pool->workers);
+	pool->workers = 0;
+}
+/** pool_collect
+ * concatenate the states of the segments, in order, into a single
+ * zero terminated list
+ */
+static struct Crypto1State*
+pool_collect(struct pool *pool, const struct segment *seg, size_t n)
+{
+	struct Crypto1State *statelist, *sl;
+	size_t i, total;
+
+	for(total = 0, i = 0; i < n; ++i)
+		total += seg[i].len;
+	sl = statelist = malloc(sizeof(*statelist) * (total + 1));
+	if(!statelist)
+		return 0;
+	for(i = 0; i < n; sl += seg[i++].len)
+		memcpy(sl, pool->workers[seg[i].worker].sl.head + seg[i].first,
+		       seg[i].len * sizeof(*sl));
+	sl->odd = sl->even = 0;
+	return statelist;
+}
+
+/* one matching pair of MSB buckets from the first join of recover */
+struct bucket_pair {
+	uint32_t *o_head, *o_tail, *e_head, *e_tail;
+};
+struct recovery32_job {
+	struct bucket_pair pairs[256], *order[256];
+	struct segment seg[256];
+	uint32_t oks, eks, in;
+};
+
+static int pair_cmp(const void *a, const void *b)
+{
+	const struct bucket_pair *x = *(struct bucket_pair * const *)a;
+	const struct bucket_pair *y = *(struct bucket_pair * const *)b;
+	size_t cx = (x->o_tail - x->o_head) + (x->e_tail - x->e_head);
+	size_t cy = (y->o_tail - y->o_head) + (y->e_tail - y->e_head);
+
+	return cx < cy ? 1 : cx > cy ? -1 : 0;
+}
+/** recovery32_work
+ * claim bucket pairs, largest first, and join each in private tables
+ */
+static void *recovery32_work(void *arg)
+{
+	struct worker *w = arg;
+	struct recovery32_job *job = w->pool->job;
+	struct bucket_pair *p;
+	struct segment *seg;
+	uint32_t *o = 0, *e = 0;
+	size_t i, no, ne;
+
+	while(pool_claim(w, &i)) {
+		if(!o && !(o = malloc(sizeof(uint32_t) << 21)))
+			goto fail;
+		if(!e && !(e = malloc(sizeof(uint32_t) << 21)))
+			goto fail;
+
+		p = job->order[i];
+		seg = job->seg + (p - job->pairs);
+		no = p->o_tail - p->o_head + 1;
+		ne = p->e_tail - p->e_head + 1;
+		memcpy(o, p->o_head, no * sizeof(*o));
+		memcpy(e, p->e_head, ne * sizeof(*e));
+
+		seg->worker = w->id;
+		seg->first = w->sl.len;
+		if(recover(o, o + no - 1, job->oks, e, e + ne - 1, job->eks,
+			   7, job->in, statelist_add, &w->sl))
+			goto fail;
+		seg->len = w->sl.len - seg->first;
 	}
+	free(o);
+	free(e);
+	return 0;
+fail:
+	pool_fail(w->pool);
+	free(o);
+	free(e);
+	return 0;
+}
+/** lfsr_recovery32_mt
+ * lfsr_recovery32 with the joins below the first level of recover spread
+ * over a pool of threads (0 for one per online cpu). The statelist is
+ * identical, entry for entry, to the one of lfsr_recovery32.
+ */
+struct Crypto1State* lfsr_recovery32_mt(uint32_t ks2, uint32_t in, int threads)
+{
+	struct Crypto1State *statelist = 0;
+	struct recovery32_side odd = {0}, even = {0};
+	struct recovery32_job *job;
+	struct pool pool = {0};
+	struct bucket_pair *p;
+	size_t n = 0;
+	int i;
 
-	in = (in >> 16 & 0xff) | (in << 16) | (in & 0xff00);
-	recover(odd_head, odd_tail, oks,
-		even_head, even_tail, eks, 11, statelist, in << 1);
+	odd.head = malloc(sizeof(uint32_t) << 21);
+	even.head = malloc(sizeof(uint32_t) << 21);
+	pool.job = job = malloc(sizeof(*job));
+	if(!odd.head || !even.head || !job)
+		goto out;
+
+	recovery32_init(&odd, &even, ks2, in);
+	odd.rounds = even.rounds = 4;
+	if(nthreads(threads) < 2 ||
+	   pthread_create(&even.thread, 0, recovery32_side, &even)) {
+		recovery32_side(&odd);
+		recovery32_side(&even);
+	} else {
+		recovery32_side(&odd);
+		pthread_join(even.thread, 0);
+	}
+	STAT(stats_side(&odd));
+	STAT(stats_side(&even));
+
+	for(i = 256; i--;)
+		if(odd.bucket[i] < odd.bucket[i + 1] &&
+		   even.bucket[i] < even.bucket[i + 1]) {
+			p = job->pairs + n;
+			job->order[n++] = p;
+			p->o_head = odd.bucket[i];
+			p->o_tail = odd.bucket[i + 1] - 1;
+			p->e_head = even.bucket[i];
+			p->e_tail = even.bucket[i + 1] - 1;
+		}
+	qsort(job->order, n, sizeof(*job->order), pair_cmp);
+	STAT(stats.joins[0] += n);
+
+	job->oks = odd.ks;
+	job->eks = even.ks;
+	job->in = even.in;
+	if(!pool_run(&pool, threads, n, recovery32_work))
+		statelist = pool_collect(&pool, job->seg, n);
 
 out:
-	free(odd_head);
-	free(even_head);
+	pool_free(&pool);
+	free(job);
+	free(odd.head);
+	free(even.head);
 	return statelist;
 }
 
@@ -242,32 +937,65 @@ static const uint32_t T2[] = {  0x3C88B810, 0x5E445C08, 0x2982A580, 0x14C152C0,
 	0x0E33A4A8, 0x01B959D0, 0x40DCACE8, 0x26CEDDF0};
 static const uint32_t C1[] = { 0x846B5, 0x4235A, 0x211AD};
 static const uint32_t C2[] = { 0x1A822E0, 0x21A822E0, 0x21A822E0};
-/** Reverse 64 bits of keystream into possible cipher states
- * Variation mentioned in the paper. Somewhat optimized version
- */
-struct Crypto1State* lfsr_recovery64(uint32_t ks2, uint32_t ks3)
+/* keystream of lfsr_recovery64 split into the bits each half filters */
+struct recovery64_ks {
+	uint8_t oks[32], eks[32];
+};
+static void recovery64_init(struct recovery64_ks *ks, uint32_t ks2, uint32_t ks3)
 {
-	struct Crypto1State *statelist, *sl;
-	uint8_t oks[32], eks[32], hi[32];
-	uint32_t low = 0,  win = 0;
-	uint32_t *tail, table[1 << 16];
-	int i, j;
-
-	sl = statelist = malloc(sizeof(struct Crypto1State) << 4);
-	if(!sl)
-		return 0;
-	sl->odd = sl->even = 0;
+	int i;
 
 	for(i = 30; i >= 0; i -= 2) {
-		oks[i >> 1] = BEBIT(ks2, i);
-		oks[16 + (i >> 1)] = BEBIT(ks3, i);
+		ks->oks[i >> 1] = BEBIT(ks2, i);
+		ks->oks[16 + (i >> 1)] = BEBIT(ks3, i);
 	}
 	for(i = 31; i >= 0; i -= 2) {
-		eks[i >> 1] = BEBIT(ks2, i);
-		eks[16 + (i >> 1)] = BEBIT(ks3, i);
+		ks->eks[i >> 1] = BEBIT(ks2, i);
+		ks->eks[16 + (i >> 1)] = BEBIT(ks3, i);
 	}
+}
+/* the parities against S1, T1, S2 and T2 as linear maps, first mask in the
+ * most significant bit, split into the contributions of each input byte
+ */
+static uint32_t linmap[4][4][256];
+static pthread_once_t linmap_once = PTHREAD_ONCE_INIT;
+
+static void linmap_init(void)
+{
+	static const uint32_t *masks[] = {S1, T1, S2, T2};
+	static const int len[] = {19, 32, 19, 32};
+	uint32_t v;
+	int m, b, j;
 
-	for(i = 0xfffff; i >= 0; --i) {
+	for(m = 0; m < 4; ++m)
+		for(b = 0; b < 4; ++b)
+			for(v = 0; v < 256; ++v)
+				for(j = 0; j < len[m]; ++j)
+					linmap[m][b][v] |= (uint32_t)
+						parity(v << 8 * b & masks[m][j])
+						<< (len[m] - 1 - j);
+}
+static inline uint32_t linear(const uint32_t map[4][256], uint32_t x)
+{
+	return map[0][x & 0xff] ^ map[1][x >> 8 & 0xff] ^
+	       map[2][x >> 16 & 0xff] ^ map[3][x >> 24];
+}
+/** recovery64_range
+ * try the 20 bit candidates from hi down to lo, table is scratch space
+ * for 1 << 16 entries
+ */
+static int recovery64_range(const struct recovery64_ks *ks, int hi, int lo,
+			    uint32_t *table, crapto1_cb cb, void *arg)
+{
+	struct Crypto1State s;
+	const uint8_t *oks = ks->oks, *eks = ks->eks;
+	uint32_t low, hibits, c1, win, t2;
+	uint32_t *tail;
+	int i, j, ret;
+
+	pthread_once(&linmap_once, linmap_init);
+
+	for(i = hi; i >= lo; --i) {
 		if (filter(i) != oks[0])
 			continue;
 
@@ -278,37 +1006,137 @@ struct Crypto1State* lfsr_recovery64(uint32_t ks2, uint32_t ks3)
 		if(tail < table)
 			continue;
 
-		for(j = 0; j < 19; ++j)
-			low = low << 1 | parity(i & S1[j]);
-		for(j = 0; j < 32; ++j)
-			hi[j] = parity(i & T1[j]);
+		low = linear(linmap[0], i);
+		hibits = linear(linmap[1], i);
+		for(c1 = 0, j = 0; j < 3; ++j)
+			c1 |= parity(i & C1[j]) << j;
 
 		for(; tail >= table; --tail) {
 			for(j = 0; j < 3; ++j) {
 				*tail = *tail << 1;
-				*tail |= parity((i & C1[j]) ^ (*tail & C2[j]));
+				*tail |= parity(*tail & C2[j]) ^ (c1 >> j & 1);
 				if(filter(*tail) != oks[29 + j])
 					goto continue2;
 			}
 
-			for(j = 0; j < 19; ++j)
-				win = win << 1 | parity(*tail & S2[j]);
-
-			win ^= low;
+			win = linear(linmap[2], *tail) ^ low;
+			t2 = linear(linmap[3], *tail) ^ hibits;
 			for(j = 0; j < 32; ++j) {
-				win = win << 1 ^ hi[j] ^ parity(*tail & T2[j]);
+				win = win << 1 ^ (t2 >> (31 - j) & 1);
 				if(filter(win) != eks[j])
 					goto continue2;
 			}
 
 			*tail = *tail << 1 | parity(LF_POLY_EVEN & *tail);
-			sl->odd = *tail ^ parity(LF_POLY_ODD & win);
-			sl->even = win;
-			++sl;
-			sl->odd = sl->even = 0;
+			s.odd = *tail ^ parity(LF_POLY_ODD & win);
+			s.even = win;
+			STAT(++stats.candidates);
+			if((ret = cb(&s, arg)))
+				return ret;
 			continue2:;
 		}
 	}
+	return 0;
+}
+/** lfsr_recovery64_cb
+ * lfsr_recovery64 handing each candidate state to cb, see lfsr_recovery32_cb
+ */
+int lfsr_recovery64_cb(uint32_t ks2, uint32_t ks3, crapto1_cb cb, void *arg)
+{
+	struct recovery64_ks ks;
+	uint32_t table[1 << 16];
+
+	recovery64_init(&ks, ks2, ks3);
+	return recovery64_range(&ks, 0xfffff, 0, table, cb, arg);
+}
+/** lfsr_recovery64_shard
+ * part shard of shards of lfsr_recovery64_cb, cut along the outer candidate
+ * loop: the states of all the shards in shard order are lfsr_recovery64's
+ */
+int lfsr_recovery64_shard(uint32_t ks2, uint32_t ks3, unsigned shard,
+			  unsigned shards, crapto1_cb cb, void *arg)
+{
+	struct recovery64_ks ks;
+	uint32_t table[1 << 16];
+
+	if(shard >= shards)
+		return -1;
+	recovery64_init(&ks, ks2, ks3);
+	return recovery64_range(&ks, 0xfffff - (int)(0x100000ULL * shard / shards),
+				0x100000 - (int)(0x100000ULL * (shard + 1) / shards),
+				table, cb, arg);
+}
+/** Reverse 64 bits of keystream into possible cipher states
+ * Variation mentioned in the paper. Somewhat optimized version
+ */
+struct Crypto1State* lfsr_recovery64(uint32_t ks2, uint32_t ks3)
+{
+	struct statelist sl;
+
+	if(statelist_init(&sl, 1 << 4))
+		return 0;
+	if(lfsr_recovery64_cb(ks2, ks3, statelist_add, &sl)) {
+		free(sl.head);
+		return 0;
+	}
+	return sl.head;
+}
+
+/* lfsr_recovery64 outer loop cut into shards of 1 << 12 candidates */
+struct recovery64_job {
+	struct recovery64_ks ks;
+	struct segment seg[1 << 8];
+};
+/** recovery64_work
+ * claim shards of the candidate range, highest first, with a private table
+ */
+static void *recovery64_work(void *arg)
+{
+	struct worker *w = arg;
+	struct recovery64_job *job = w->pool->job;
+	uint32_t *table = 0;
+	size_t i;
+	int hi;
+
+	while(pool_claim(w, &i)) {
+		if(!table && !(table = malloc(sizeof(uint32_t) << 16)))
+			goto fail;
+
+		hi = 0xfffff - (i << 12);
+		job->seg[i].worker = w->id;
+		job->seg[i].first = w->sl.len;
+		if(recovery64_range(&job->ks, hi, hi - 0xfff, table,
+				    statelist_add, &w->sl))
+			goto fail;
+		job->seg[i].len = w->sl.len - job->seg[i].first;
+	}
+	free(table);
+	return 0;
+fail:
+	pool_fail(w->pool);
+	free(table);
+	return 0;
+}
+/** lfsr_recovery64_mt
+ * lfsr_recovery64 with the outer candidate loop sharded over a pool of
+ * threads (0 for one per online cpu), same statelist, in the same order
+ */
+struct Crypto1State* lfsr_recovery64_mt(uint32_t ks2, uint32_t ks3, int threads)
+{
+	struct Crypto1State *statelist = 0;
+	struct recovery64_job *job;
+	struct pool pool = {0};
+
+	pool.job = job = malloc(sizeof(*job));
+	if(!job)
+		return 0;
+
+	recovery64_init(&job->ks, ks2, ks3);
+	if(!pool_run(&pool, threads, 1 << 8, recovery64_work))
+		statelist = pool_collect(&pool, job->seg, 1 << 8);
+
+	pool_free(&pool);
+	free(job);
 	return statelist;
 }
 
@@ -354,29 +1182,281 @@ uint32_t lfsr_rollback_word(struct Crypto1State *s, uint32_t in, int fb)
 	return ret;
 }
 
+/* Rolling the LFSR back by a byte without the keystream fed back is linear.
+ * The tables give the 8 bits it brings back, the ones that end up in odd in
+ * the high nibble and the ones in even in the low nibble, per byte of odd,
+ * even and input.
+ */
+static uint8_t rollback_odd[3][256], rollback_even[3][256], rollback_in[256];
+static pthread_once_t rollback_once = PTHREAD_ONCE_INIT;
+
+static uint8_t rollback_new(uint32_t odd, uint32_t even, uint32_t in)
+{
+	struct Crypto1State s = {odd, even};
+
+	lfsr_rollback_byte(&s, in, 0);
+	return (s.odd >> 20) << 4 | s.even >> 20;
+}
+static void rollback_init(void)
+{
+	uint32_t v;
+	int b;
+
+	for(v = 0; v < 256; ++v) {
+		for(b = 0; b < 3; ++b) {
+			rollback_odd[b][v] = rollback_new(v << 8 * b, 0, 0);
+			rollback_even[b][v] = rollback_new(0, v << 8 * b, 0);
+		}
+		rollback_in[v] = rollback_new(0, 0, v);
+	}
+}
+/** lfsr_rollback_word_batch
+ * lfsr_rollback_word on n states held as separate odd and even halves,
+ * a byte at a time from tables when nothing is fed back, the keystream
+ * is not returned and the halves come back masked to 24 bits
+ */
+void lfsr_rollback_word_batch(uint32_t *odd, uint32_t *even, size_t n,
+			      uint32_t in, int fb)
+{
+	uint32_t o, e, x;
+	size_t i, len;
+	int k;
+
+	for(i = 0; i < n; ++i) {
+		odd[i] &= 0xffffff;
+		even[i] &= 0xffffff;
+	}
+	if(fb) {
+		void (*batch)(uint32_t *, uint32_t *, size_t, uint32_t) =
+			kernels()->rollback_bit_batch;
+
+		/* blocks of states that stay in L1 over the 32 passes */
+		for(i = 0; i < n; i += len) {
+			len = n - i < 1 << 10 ? n - i : 1 << 10;
+			for(k = 31; k >= 0; --k)
+				batch(odd + i, even + i, len, BEBIT(in, k));
+		}
+		return;
+	}
+
+	pthread_once(&rollback_once, rollback_init);
+	for(i = 0; i < n; ++i) {
+		o = odd[i];
+		e = even[i];
+		for(k = 0; k < 32; k += 8) {
+			x = rollback_odd[0][o & 0xff] ^ rollback_odd[1][o >> 8 & 0xff];
+			x ^= rollback_odd[2][o >> 16] ^ rollback_even[0][e & 0xff];
+			x ^= rollback_even[1][e >> 8 & 0xff] ^ rollback_even[2][e >> 16];
+			x ^= rollback_in[in >> k & 0xff];
+			o = o >> 4 | (x >> 4) << 20;
+			e = e >> 4 | (x & 0xf) << 20;
+		}
+		odd[i] = o;
+		even[i] = e;
+	}
+}
 /** nonce_distance
  * x,y valid tag nonces, then prng_successor(x, nonce_distance(x, y)) = y
  */
-static uint16_t *dist = 0;
-int nonce_distance(uint32_t from, uint32_t to)
+static uint16_t dist[1 << 16];
+static pthread_once_t dist_once = PTHREAD_ONCE_INIT;
+
+static void dist_init(void)
 {
 	uint16_t x, i;
-	if(!dist) {
-		dist = malloc(2 << 16);
-		if(!dist)
-			return -1;
-		for (x = i = 1; i; ++i) {
-			dist[(x & 0xff) << 8 | x >> 8] = i;
-			x = x >> 1 | (x ^ x >> 2 ^ x >> 3 ^ x >> 5) << 15;
-		}
+
+	for (x = i = 1; i; ++i) {
+		dist[(x & 0xff) << 8 | x >> 8] = i;
+		x = x >> 1 | (x ^ x >> 2 ^ x >> 3 ^ x >> 5) << 15;
 	}
+}
+int nonce_distance(uint32_t from, uint32_t to)
+{
+	pthread_once(&dist_once, dist_init);
 	return (65535 + dist[to >> 16] - dist[from >> 16]) % 65535;
 }
 
+/* the valid nonces of every parity pattern of one FOREACH_VALID_NONCE
+ * FSIZE: a header of magic, fsize and 1 << 16, the 1 << fsize + 1 list
+ * offsets and the nonces grouped by pattern, in host byte order
+ */
+#define NONCES_MAGIC 0x31434e56
+struct crapto1_nonces {
+	uint32_t *head;
+	size_t size;
+	int fsize;
+};
+/** nonce_pattern
+ * the FILTER of FOREACH_VALID_NONCE the nonce grown from the 16 bit m
+ * passes with
+ */
+static uint32_t nonce_pattern(uint32_t m, int fsize)
+{
+	uint32_t p = 0;
+	int i;
+
+	for(i = fsize - 1; i >= 0; --i) {
+		p |= (uint32_t)parity(m & 0xFF01) << i;
+		if(i)
+			m = prng_successor(m, i == 7 ? 48 : 8);
+	}
+	return p;
+}
+static void nonces_fill(uint32_t *head, int fsize)
+{
+	uint32_t *offset = head + 3, *nonce = offset + (1 << fsize) + 1, n;
+
+	head[0] = NONCES_MAGIC;
+	head[1] = fsize;
+	head[2] = 1 << 16;
+	for(n = 0; n < 1 << 16; ++n)
+		++offset[nonce_pattern(n, fsize) + 1];
+	for(n = 0; n < 1u << fsize; ++n)
+		offset[n + 1] += offset[n];
+	/* the lists are filled through offset[p], which ends up at offset[p + 1] */
+	for(n = 0; n < 1 << 16; ++n)
+		nonce[offset[nonce_pattern(n, fsize)]++] = prng_successor(n, 16);
+	memmove(offset + 1, offset, sizeof(*offset) << fsize);
+	offset[0] = 0;
+}
+static int nonces_valid(const uint32_t *head, int fsize)
+{
+	return head[0] == NONCES_MAGIC && head[1] == (uint32_t)fsize &&
+	       head[2] == 1 << 16 && head[3 + (1 << fsize)] == 1 << 16;
+}
+/** nonces_save
+ * best effort, through a temporary file so readers never see half of it.
+ * mkstemp gives every writer its own, threads of one process included.
+ */
+static void nonces_save(const uint32_t *head, size_t size, const char *path)
+{
+	const char *p = (const char *)head;
+	char tmp[4096];
+	ssize_t n = 0;
+	int fd;
+
+	if(snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path) >= (int)sizeof(tmp))
+		return;
+	if((fd = mkstemp(tmp)) == -1)
+		return;
+	fchmod(fd, 0644);
+	for(; size && (n = write(fd, p, size)) > 0; p += n, size -= n);
+	if(close(fd) || n < 0 || rename(tmp, path))
+		unlink(tmp);
+}
+/** crapto1_nonces_create
+ * the valid nonce lists of every FILTER for fsize 1 to 16.  With a path the
+ * table is mapped from that file, or generated and written there when it
+ * is missing or does not match.  NULL on failure.
+ */
+struct crapto1_nonces *crapto1_nonces_create(int fsize, const char *path)
+{
+	struct crapto1_nonces *t;
+	struct stat st;
+	void *p = MAP_FAILED;
+	int fd;
+
+	if(fsize < 1 || fsize > 16 || !(t = calloc(1, sizeof(*t))))
+		return 0;
+	t->fsize = fsize;
+	t->size = sizeof(uint32_t) * (3 + (1 << fsize) + 1 + (1 << 16));
 
-static uint32_t fastfwd[2][8] = {
+	if(path && (fd = open(path, O_RDONLY)) != -1) {
+		if(!fstat(fd, &st) && st.st_size == (off_t)t->size)
+			p = mmap(0, t->size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if(p != MAP_FAILED && nonces_valid(p, fsize)) {
+			t->head = p;
+			return t;
+		}
+		if(p != MAP_FAILED)
+			munmap(p, t->size);
+	}
+
+	p = mmap(0, t->size, PROT_READ | PROT_WRITE,
+		 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(p == MAP_FAILED) {
+		free(t);
+		return 0;
+	}
+	nonces_fill(t->head = p, fsize);
+	if(path)
+		nonces_save(t->head, t->size, path);
+	return t;
+}
+void crapto1_nonces_destroy(struct crapto1_nonces *t)
+{
+	if(!t)
+		return;
+	munmap(t->head, t->size);
+	free(t);
+}
+/** crapto1_nonces_get
+ * the valid nonces for filter, in the order FOREACH_VALID_NONCE visits them
+ */
+const uint32_t *crapto1_nonces_get(const struct crapto1_nonces *t,
+				   uint32_t filter, size_t *len)
+{
+	const uint32_t *offset = t->head + 3;
+
+	filter &= (1u << t->fsize) - 1;
+	*len = offset[filter + 1] - offset[filter];
+	return offset + (1 << t->fsize) + 1 + offset[filter];
+}
+
+/* crypto1_fastfwd(fastfwd[1], fastfwd[0], 3, 35) */
+static const uint32_t fastfwd[2][8] = {
 	{ 0, 0x4BC53, 0xECB1, 0x450E2, 0x25E29, 0x6E27A, 0x2B298, 0x60ECB},
 	{ 0, 0x1D962, 0x4BC53, 0x56531, 0xECB1, 0x135D3, 0x450E2, 0x58980}};
+/** prefix_ks
+ * lfsr_prefix_ks into a caller supplied list of size entries, testing
+ * CRYPTO1_BS_LANES candidates at a time with the bitsliced filter.
+ * Returns 0 when the candidates and the -1 terminator do not fit.
+ */
+static uint32_t *
+prefix_ks(uint8_t ks[8], int isodd, uint32_t *candidates, size_t size)
+{
+	bitslice_t x[21], e[21], lane[8], match, any;
+	uint64_t m;
+	uint32_t c, pass;
+	size_t n = 0;
+	int i, k, lb;
+
+	for(lb = 0; 1 << lb < CRYPTO1_BS_LANES; ++lb)
+		for(lane[lb] = BS_ZERO, i = 0; i < CRYPTO1_BS_LANES; ++i)
+			if(BIT(i, lb))
+				BS_WORD(lane[lb], i >> 6) |= 1ULL << (i & 63);
+
+	for(pass = 0; pass < 1u << (21 - lb); ++pass) {
+		for(k = 0; k < 21; ++k)
+			x[k] = k < lb ? lane[k] :
+				BIT(pass, k - lb) ? BS_ONES : BS_ZERO;
+		for(match = BS_ONES, c = 0; c < 8; ++c) {
+			for(k = 0; k < 21; ++k)
+				e[k] = BIT(fastfwd[isodd][c], k) ? ~x[k] : x[k];
+			match &= filter_bs_lsb(e + 1) ^
+				 (BIT(ks[c], isodd) ? BS_ZERO : BS_ONES);
+			match &= filter_bs_lsb(e) ^
+				 (BIT(ks[c], isodd + 2) ? BS_ZERO : BS_ONES);
+			for(any = BS_ZERO, i = 0; i < CRYPTO1_BS_LANES / 64; ++i)
+				BS_WORD(any, 0) |= BS_WORD(match, i);
+			if(!BS_WORD(any, 0))
+				break;
+		}
+		for(i = 0; c == 8 && i < CRYPTO1_BS_LANES / 64; ++i)
+			for(m = BS_WORD(match, i); m; m &= m - 1) {
+				if(n + 1 >= size)
+					return 0;
+				candidates[n++] = pass << lb | i << 6 |
+						  __builtin_ctzll(m);
+			}
+	}
+
+	candidates[n] = -1;
+	STAT(stats.prefix_ks[isodd] += n);
+
+	return candidates;
+}
 /** lfsr_prefix_ks
  *
  * Is an exported helper function from the common prefix attack
@@ -388,33 +1468,27 @@ static uint32_t fastfwd[2][8] = {
  */
 uint32_t *lfsr_prefix_ks(uint8_t ks[8], int isodd)
 {
-	uint32_t c, entry, *candidates = malloc(4 << 10);
-	int i, size = 0, good;
+	uint32_t *candidates = malloc(4 << 10), *p;
 
-	if(!candidates)
+	/* the rare keystream with more candidates is scanned again into a
+	 * list as large as lfsr_prefix_ks_ws's
+	 */
+	if(candidates && !prefix_ks(ks, isodd, candidates, 1 << 10)) {
+		if((p = realloc(candidates, 4 << 21)) &&
+		   prefix_ks(ks, isodd, p, 1 << 21))
+			return p;
+		free(p ? p : candidates);
 		return 0;
-
-	for(i = 0; i < 1 << 21; ++i) {
-		for(c = 0, good = 1; good && c < 8; ++c) {
-			entry = i ^ fastfwd[isodd][c];
-			good &= (BIT(ks[c], isodd) == filter(entry >> 1));
-			good &= (BIT(ks[c], isodd + 2) == filter(entry));
-		}
-		if(good)
-			candidates[size++] = i;
 	}
-
-	candidates[size] = -1;
-
 	return candidates;
 }
 
 /** check_pfx_parity
  * helper function which eliminates possible secret states using parity bits
  */
-static struct Crypto1State*
+static int
 check_pfx_parity(uint32_t prefix, uint32_t rresp, uint8_t parities[8][8],
-          	uint32_t odd, uint32_t even, struct Crypto1State* sl)
+		 uint32_t odd, uint32_t even, struct Crypto1State* sl)
 {
 	uint32_t ks1, nr, ks2, rr, ks3, c, good = 1;
 
@@ -427,52 +1501,330 @@ check_pfx_parity(uint32_t prefix, uint32_t rresp, uint8_t parities[8][8],
 
 		ks3 = lfsr_rollback_bit(sl, 0, 0);
 		ks2 = lfsr_rollback_word(sl, 0, 0);
-		ks1 = lfsr_rollback_word(sl, prefix | c << 5, 1);
-
-		nr = ks1 ^ (prefix | c << 5);
 		rr = ks2 ^ rresp;
 
-		good &= parity(nr & 0x000000ff) ^ parities[c][3] ^ BIT(ks2, 24);
 		good &= parity(rr & 0xff000000) ^ parities[c][4] ^ BIT(ks2, 16);
 		good &= parity(rr & 0x00ff0000) ^ parities[c][5] ^ BIT(ks2,  8);
 		good &= parity(rr & 0x0000ff00) ^ parities[c][6] ^ BIT(ks2,  0);
 		good &= parity(rr & 0x000000ff) ^ parities[c][7] ^ ks3;
+		/* only roll back over {nr} for the 1 in 16 still in the race */
+		if(!good)
+			break;
+
+		ks1 = lfsr_rollback_word(sl, prefix | c << 5, 1);
+		nr = ks1 ^ (prefix | c << 5);
+		good &= parity(nr & 0x000000ff) ^ parities[c][3] ^ BIT(ks2, 24);
 	}
+	STAT(++stats.pfx_checked);
+	STAT(stats.pfx_rejected += !good);
+
+	return good;
+}
+
+/** prefix_join
+ * join one odd prefix candidate with all even ones, on a private copy of
+ * the pair: the 64 top bits come out the same whatever came before
+ */
+static int prefix_join(uint32_t pfx, uint32_t rr, uint8_t par[8][8],
+		       uint32_t odd, const uint32_t *even, crapto1_cb cb,
+		       void *arg)
+{
+	struct Crypto1State s;
+	uint32_t o, eo, top;
+	int ret = 0;
+
+	for(; !ret && *even + 1; ++even)
+		for(o = odd, eo = *even, top = 0; !ret && top < 64; ++top) {
+			o += 1 << 21;
+			eo += (!(top & 7) + 1) << 21;
+			if(!check_pfx_parity(pfx, rr, par, o, eo, &s))
+				continue;
+			STAT(++stats.candidates);
+			ret = cb(&s, arg);
+		}
+	return ret;
+}
+/** common_prefix
+ * join the odd and even prefix candidates
+ */
+static int common_prefix(uint32_t pfx, uint32_t rr, uint8_t par[8][8],
+			 const uint32_t *odd, const uint32_t *even,
+			 crapto1_cb cb, void *arg)
+{
+	int ret = 0;
 
-	return sl + good;
-} 
+	for(; !ret && *odd + 1; ++odd)
+		ret = prefix_join(pfx, rr, par, *odd, even, cb, arg);
+	return ret;
+}
+/** lfsr_common_prefix_cb
+ * lfsr_common_prefix handing each candidate state to cb, see
+ * lfsr_recovery32_cb
+ */
+int lfsr_common_prefix_cb(uint32_t pfx, uint32_t rr, uint8_t ks[8],
+			  uint8_t par[8][8], crapto1_cb cb, void *arg)
+{
+	uint32_t *odd, *even;
+	int ret = -1;
 
+	odd = lfsr_prefix_ks(ks, 1);
+	even = lfsr_prefix_ks(ks, 0);
+	if(odd && even)
+		ret = common_prefix(pfx, rr, par, odd, even, cb, arg);
 
+	free(odd);
+	free(even);
+	return ret;
+}
+/** lfsr_common_prefix_shard
+ * part shard of shards of lfsr_common_prefix_cb, cut along the odd prefix
+ * candidates: the states of all the shards in shard order are
+ * lfsr_common_prefix's
+ */
+int lfsr_common_prefix_shard(uint32_t pfx, uint32_t rr, uint8_t ks[8],
+			     uint8_t par[8][8], unsigned shard, unsigned shards,
+			     crapto1_cb cb, void *arg)
+{
+	uint32_t *odd, *even;
+	size_t n, i;
+	int ret = -1;
+
+	if(shard >= shards)
+		return -1;
+	odd = lfsr_prefix_ks(ks, 1);
+	even = lfsr_prefix_ks(ks, 0);
+	if(odd && even) {
+		for(n = 0; odd[n] + 1; ++n);
+		for(ret = 0, i = n * shard / shards;
+		    !ret && i < n * (shard + 1) / shards; ++i)
+			ret = prefix_join(pfx, rr, par, odd[i], even, cb, arg);
+	}
+	free(odd);
+	free(even);
+	return ret;
+}
 /** lfsr_common_prefix
  * Implentation of the common prefix attack.
  */
 struct Crypto1State*
 lfsr_common_prefix(uint32_t pfx, uint32_t rr, uint8_t ks[8], uint8_t par[8][8])
 {
-	struct Crypto1State *statelist, *s;
-	uint32_t *odd, *even, *o, *e, top;
+	struct statelist sl;
 
-	odd = lfsr_prefix_ks(ks, 1);
-	even = lfsr_prefix_ks(ks, 0);
+	if(statelist_init(&sl, 1 << 4))
+		return 0;
+	if(lfsr_common_prefix_cb(pfx, rr, ks, par, statelist_add, &sl)) {
+		free(sl.head);
+		return 0;
+	}
+	return sl.head;
+}
+
+
+/* lfsr_common_prefix with one odd candidate per task */
+struct prefix_job {
+	uint32_t pfx, rr, *odd, *even;
+	uint8_t (*par)[8];
+	struct segment *seg;
+	size_t found, size;
+};
+/** prefix_add
+ * statelist_add to the worker's list while the caller's buffer has room
+ */
+static int prefix_add(struct Crypto1State *s, void *arg)
+{
+	struct worker *w = arg;
+	struct prefix_job *job = w->pool->job;
+
+	if(__atomic_fetch_add(&job->found, 1, __ATOMIC_RELAXED) >= job->size)
+		return 0;
+	return statelist_add(s, &w->sl);
+}
+/** prefix_work
+ * join claimed odd candidates with all even ones
+ */
+static void *prefix_work(void *arg)
+{
+	struct worker *w = arg;
+	struct prefix_job *job = w->pool->job;
+	size_t i;
 
-	s = statelist = malloc((sizeof *statelist) << 20);
-	if(!s || !odd || !even) {
-		free(statelist);
-		statelist = 0;
-                goto out;
+	while(pool_claim(w, &i)) {
+		job->seg[i].worker = w->id;
+		job->seg[i].first = w->sl.len;
+		if(prefix_join(job->pfx, job->rr, job->par, job->odd[i],
+			       job->even, prefix_add, w)) {
+			pool_fail(w->pool);
+			return 0;
+		}
+		job->seg[i].len = w->sl.len - job->seg[i].first;
 	}
+	return 0;
+}
+/** lfsr_common_prefix_mt
+ * lfsr_common_prefix with the odd x even x top product spread over a pool
+ * of threads (0 for one per online cpu), writing at most size states to
+ * out in the order of lfsr_common_prefix.  Returns how many states were
+ * found, more than size when out was too small (which of them made it is
+ * then unspecified), or -1 when out of memory.
+ */
+int lfsr_common_prefix_mt(uint32_t pfx, uint32_t rr, uint8_t ks[8],
+			  uint8_t par[8][8], struct Crypto1State *out,
+			  size_t size, int threads)
+{
+	struct prefix_job job = {pfx, rr, 0, 0, par, 0, 0, size};
+	struct pool pool = {0};
+	size_t i, n, len;
+	int ret = -1;
 
-	for(o = odd; *o + 1; ++o)
-		for(e = even; *e + 1; ++e)
-			for(top = 0; top < 64; ++top) {
-				*o += 1 << 21;
-				*e += (!(top & 7) + 1) << 21;
-				s = check_pfx_parity(pfx, rr, par, *o, *e, s);
-			}
+	pool.job = &job;
+	job.odd = lfsr_prefix_ks(ks, 1);
+	job.even = lfsr_prefix_ks(ks, 0);
+	if(!job.odd || !job.even)
+		goto out;
+	for(n = 0; job.odd[n] + 1; ++n);
+	if(!(job.seg = calloc(n + 1, sizeof(*job.seg))))
+		goto out;
 
-	s->odd = s->even = 0;
+	if(pool_run(&pool, threads, n, prefix_work))
+		goto out;
+	for(len = i = 0; i < n && len < size; len += job.seg[i++].len) {
+		if(job.seg[i].len > size - len)
+			job.seg[i].len = size - len;
+		memcpy(out + len, pool.workers[job.seg[i].worker].sl.head +
+		       job.seg[i].first, job.seg[i].len * sizeof(*out));
+	}
+	ret = job.found;
 out:
-	free(odd);
-	free(even);
-	return statelist;
+	pool_free(&pool);
+	free(job.seg);
+	free(job.odd);
+	free(job.even);
+	return ret;
+}
+/* buffers of the recovery functions kept alive between calls */
+struct crapto1_ws {
+	uint32_t *odd, *even;
+	size_t size;
+	struct statelist sl;
+};
+/** crapto1_ws_create
+ * allocate a workspace for the _ws variants of the recovery functions.
+ * With CRAPTO1_WS_HUGEPAGES the 16 MB of tables are taken from the
+ * hugetlbfs pool when it has room, else transparent huge pages are asked
+ * for. A workspace must not be used by two threads at once.
+ */
+struct crapto1_ws *crapto1_ws_create(int flags)
+{
+	struct crapto1_ws *ws = calloc(1, sizeof(*ws));
+	void *p = MAP_FAILED;
+
+	if(!ws)
+		return 0;
+
+	ws->size = sizeof(uint32_t) << 22;
+#ifdef MAP_HUGETLB
+	if(flags & CRAPTO1_WS_HUGEPAGES)
+		p = mmap(0, ws->size, PROT_READ | PROT_WRITE,
+			 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+	if(p == MAP_FAILED) {
+		p = mmap(0, ws->size, PROT_READ | PROT_WRITE,
+			 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if(p == MAP_FAILED)
+			goto fail;
+#ifdef MADV_HUGEPAGE
+		if(flags & CRAPTO1_WS_HUGEPAGES)
+			madvise(p, ws->size, MADV_HUGEPAGE);
+#endif
+	}
+	ws->odd = p;
+	ws->even = ws->odd + (1 << 21);
+
+	if(statelist_init(&ws->sl, 1 << 12))
+		goto fail;
+	return ws;
+fail:
+	crapto1_ws_destroy(ws);
+	return 0;
+}
+void crapto1_ws_destroy(struct crapto1_ws *ws)
+{
+	if(!ws)
+		return;
+	if(ws->odd)
+		munmap(ws->odd, ws->size);
+	free(ws->sl.head);
+	free(ws);
+}
+/** ws_list
+ * empty the statelist of the workspace
+ */
+static struct statelist *ws_list(struct crapto1_ws *ws)
+{
+	ws->sl.len = 0;
+	ws->sl.head->odd = ws->sl.head->even = 0;
+	return &ws->sl;
+}
+int lfsr_recovery32_cb_ws(struct crapto1_ws *ws, uint32_t ks2, uint32_t in,
+			  crapto1_cb cb, void *arg)
+{
+	return recovery32(ws->odd, ws->even, ks2, in, cb, arg);
+}
+/** lfsr_recovery32_ws
+ * lfsr_recovery32 on the buffers of ws, the returned list belongs to ws
+ * and stays valid until its next use.
+ */
+struct Crypto1State*
+lfsr_recovery32_ws(struct crapto1_ws *ws, uint32_t ks2, uint32_t in)
+{
+	struct statelist *sl = ws_list(ws);
+
+	return recovery32(ws->odd, ws->even, ks2, in, statelist_add, sl) ?
+		0 : sl->head;
+}
+int lfsr_recovery64_cb_ws(struct crapto1_ws *ws, uint32_t ks2, uint32_t ks3,
+			  crapto1_cb cb, void *arg)
+{
+	struct recovery64_ks ks;
+
+	recovery64_init(&ks, ks2, ks3);
+	return recovery64_range(&ks, 0xfffff, 0, ws->odd, cb, arg);
+}
+struct Crypto1State*
+lfsr_recovery64_ws(struct crapto1_ws *ws, uint32_t ks2, uint32_t ks3)
+{
+	struct statelist *sl = ws_list(ws);
+
+	return lfsr_recovery64_cb_ws(ws, ks2, ks3, statelist_add, sl) ?
+		0 : sl->head;
+}
+/** lfsr_prefix_ks_ws
+ * lfsr_prefix_ks into ws, the odd and even lists are separate so one of
+ * each can be held at a time.
+ */
+uint32_t *lfsr_prefix_ks_ws(struct crapto1_ws *ws, uint8_t ks[8], int isodd)
+{
+	return prefix_ks(ks, isodd, isodd ? ws->odd : ws->even, 1 << 21);
+}
+int lfsr_common_prefix_cb_ws(struct crapto1_ws *ws, uint32_t pfx, uint32_t rr,
+			     uint8_t ks[8], uint8_t par[8][8],
+			     crapto1_cb cb, void *arg)
+{
+	uint32_t *odd, *even;
+
+	odd = lfsr_prefix_ks_ws(ws, ks, 1);
+	even = lfsr_prefix_ks_ws(ws, ks, 0);
+	if(!odd || !even)
+		return -1;
+	return common_prefix(pfx, rr, par, odd, even, cb, arg);
+}
+struct Crypto1State*
+lfsr_common_prefix_ws(struct crapto1_ws *ws, uint32_t pfx, uint32_t rr,
+		      uint8_t ks[8], uint8_t par[8][8])
+{
+	struct statelist *sl = ws_list(ws);
+
+	return lfsr_common_prefix_cb_ws(ws, pfx, rr, ks, par,
+					statelist_add, sl) ? 0 : sl->head;
 }
@@ -20,28 +20,110 @@
 #ifndef CRAPTO1_INCLUDED
 #define CRAPTO1_INCLUDED
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* The only global state is constant tables, some of them built on first
+ * use under pthread_once, so every function may run in several threads at
+ * once.  Objects are not locked: a Crypto1State or a crapto1_ws is used by
+ * one thread at a time, a crapto1_nonces table may be shared for reading.
+ */
 struct Crypto1State {uint32_t odd, even;};
 struct Crypto1State* crypto1_create(uint64_t);
 void crypto1_destroy(struct Crypto1State*);
 void crypto1_get_lfsr(struct Crypto1State*, uint64_t*);
+void crypto1_get_lfsr_batch(const uint32_t *odd, const uint32_t *even,
+			    size_t n, uint64_t *lfsr);
 uint8_t crypto1_bit(struct Crypto1State*, uint8_t, int);
 uint8_t crypto1_byte(struct Crypto1State*, uint8_t, int);
 uint32_t crypto1_word(struct Crypto1State*, uint32_t, int);
+void crypto1_keystream(struct Crypto1State*, uint8_t*, uint8_t*, size_t);
 uint32_t prng_successor(uint32_t x, uint32_t n);
+uint32_t prng_jump(uint32_t x, uint32_t n);
+void prng_jump_batch(uint32_t *out, const uint32_t *x, size_t len, uint32_t n);
+void crypto1_jump(struct Crypto1State *s, uint64_t n);
+void crypto1_fastfwd(uint32_t *odd, uint32_t *even, int bits, uint64_t n);
+
+typedef int (*crapto1_cb)(struct Crypto1State*, void*);
 
 struct Crypto1State* lfsr_recovery32(uint32_t ks2, uint32_t in);
+int lfsr_recovery32_cb(uint32_t ks2, uint32_t in, crapto1_cb cb, void *arg);
+struct Crypto1State* lfsr_recovery32_mt(uint32_t ks2, uint32_t in, int threads);
 struct Crypto1State* lfsr_recovery64(uint32_t ks2, uint32_t ks3);
+struct Crypto1State* lfsr_recovery64_mt(uint32_t ks2, uint32_t ks3, int threads);
+int lfsr_recovery64_cb(uint32_t ks2, uint32_t ks3, crapto1_cb cb, void *arg);
+int lfsr_recovery64_shard(uint32_t ks2, uint32_t ks3, unsigned shard,
+			  unsigned shards, crapto1_cb cb, void *arg);
 uint32_t *lfsr_prefix_ks(uint8_t ks[8], int isodd);
 struct Crypto1State*
 lfsr_common_prefix(uint32_t pfx, uint32_t rr, uint8_t ks[8], uint8_t par[8][8]);
+int lfsr_common_prefix_cb(uint32_t pfx, uint32_t rr, uint8_t ks[8],
+			  uint8_t par[8][8], crapto1_cb cb, void *arg);
+int lfsr_common_prefix_mt(uint32_t pfx, uint32_t rr, uint8_t ks[8],
+			  uint8_t par[8][8], struct Crypto1State *out,
+			  size_t size, int threads);
+int lfsr_common_prefix_shard(uint32_t pfx, uint32_t rr, uint8_t ks[8],
+			     uint8_t par[8][8], unsigned shard, unsigned shards,
+			     crapto1_cb cb, void *arg);
+
+/* reusable buffers for back to back recoveries, one per thread */
+struct crapto1_ws;
+#define CRAPTO1_WS_HUGEPAGES 1
+struct crapto1_ws *crapto1_ws_create(int flags);
+void crapto1_ws_destroy(struct crapto1_ws*);
+struct Crypto1State*
+lfsr_recovery32_ws(struct crapto1_ws*, uint32_t ks2, uint32_t in);
+int lfsr_recovery32_cb_ws(struct crapto1_ws*, uint32_t ks2, uint32_t in,
+			  crapto1_cb cb, void *arg);
+struct Crypto1State*
+lfsr_recovery64_ws(struct crapto1_ws*, uint32_t ks2, uint32_t ks3);
+int lfsr_recovery64_cb_ws(struct crapto1_ws*, uint32_t ks2, uint32_t ks3,
+			  crapto1_cb cb, void *arg);
+uint32_t *lfsr_prefix_ks_ws(struct crapto1_ws*, uint8_t ks[8], int isodd);
+struct Crypto1State*
+lfsr_common_prefix_ws(struct crapto1_ws*, uint32_t pfx, uint32_t rr,
+		      uint8_t ks[8], uint8_t par[8][8]);
+int lfsr_common_prefix_cb_ws(struct crapto1_ws*, uint32_t pfx, uint32_t rr,
+			     uint8_t ks[8], uint8_t par[8][8],
+			     crapto1_cb cb, void *arg);
+
+/* the vector kernels in use, picked at the first recovery from what the
+ * cpu runs or by name from CRAPTO1_ISA in the environment: avx512, avx2,
+ * ssse3 or scalar.  Every variant is checked against the scalar code
+ * before it is used.
+ */
+const char *crapto1_isa(void);
+int crapto1_use_isa(const char *name);
+int crapto1_selftest(void);
+
+/* what the recoveries of a thread went through, counted only when crapto1.c
+ * is built with -DCRAPTO1_STATS.  The _mt variants add in what their
+ * workers counted before they return.
+ */
+struct crapto1_stats {
+	/* table entries of the even [0] and odd [1] half of lfsr_recovery32
+	 * after its first 1 .. 16 keystream bits, summed over the joins
+	 */
+	uint64_t survivors[2][16];
+	/* bucket pairs joined at the top and at both levels of recover */
+	uint64_t joins[3];
+	/* states handed to the callback, by every recovery */
+	uint64_t candidates;
+	/* lfsr_common_prefix: lfsr_prefix_ks candidates of the even and odd
+	 * half, states tried against the parities and rejected by them
+	 */
+	uint64_t prefix_ks[2], pfx_checked, pfx_rejected;
+};
+int crapto1_stats(struct crapto1_stats *out, int reset);
 
 uint8_t lfsr_rollback_bit(struct Crypto1State* s, uint32_t in, int fb);
 uint8_t lfsr_rollback_byte(struct Crypto1State* s, uint32_t in, int fb);
 uint32_t lfsr_rollback_word(struct Crypto1State* s, uint32_t in, int fb);
+void lfsr_rollback_jump(struct Crypto1State *s, uint64_t n);
+void lfsr_rollback_word_batch(uint32_t *odd, uint32_t *even, size_t n,
+			      uint32_t in, int fb);
 int nonce_distance(uint32_t from, uint32_t to);
 #define FOREACH_VALID_NONCE(N, FILTER, FSIZE)\
 	uint32_t __n = 0,__M = 0, N = 0;\
@@ -54,6 +136,22 @@ int nonce_distance(uint32_t from, uint32_t to);
 				__M = prng_successor(__M, (__i == 7) ? 48 : 8);\
 			else 
 
+/* FOREACH_VALID_NONCE from lists precomputed, and optionally kept in a file,
+ * for one FSIZE: FOREACH_VALID_NONCE_TABLE(N, t, FILTER) visits the same
+ * nonces in the same order as FOREACH_VALID_NONCE(N, FILTER, FSIZE)
+ */
+struct crapto1_nonces;
+struct crapto1_nonces *crapto1_nonces_create(int fsize, const char *path);
+void crapto1_nonces_destroy(struct crapto1_nonces*);
+const uint32_t *crapto1_nonces_get(const struct crapto1_nonces*,
+				   uint32_t filter, size_t *len);
+#define FOREACH_VALID_NONCE_TABLE(N, TABLE, FILTER)\
+	size_t __len;\
+	const uint32_t *__p = crapto1_nonces_get(TABLE, FILTER, &__len);\
+	const uint32_t *__end = __p + __len;\
+	uint32_t N = 0;\
+	for(; __p < __end && (N = *__p, 1); ++__p)
+
 #define LF_POLY_ODD (0x29CE5C)
 #define LF_POLY_EVEN (0x870804)
 #define BIT(x, n) ((x) >> (n) & 1)
@@ -0,0 +1,4099 @@
+/* generated by crapto1-genlut, do not edit */
+static const uint32_t filterlut[1 << 15] = {
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0x0000f22c, 0x00000000, 0xf22cf22c, 0xf22c0000, 0x0000f22c, 0xf22c0000, 0x00000000,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c, 0xf22cf22c,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xf22cf22c, 0xfffff22c, 0xffffffff, 0xf22cf22c, 0xf22cffff, 0xfffff22c, 0xf22cffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffff0000, 0x0000ffff, 0xffff0000, 0x00000000,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x0dd30dd3, 0xffff0dd3, 0xffffffff, 0x0dd30dd3, 0x0dd3ffff, 0xffff0dd3, 0x0dd3ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+	0x00000000, 0xffff0000, 0xffffffff, 0x00000000, 0x0000ffff, 0xffff0000, 0x0000ffff, 0xffffffff,
+};
@@ -0,0 +1,375 @@
+/*  crapto1_simd.h
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+
+    The vector kernels of crapto1.c, the filter of a vector of table
+    entries at a time and the survivors compacted into an output buffer.
+    Included by crapto1.c once per instruction set, with CRAPTO1_ISA set to
+    0 (scalar), 1 (SSSE3), 2 (AVX2) or 3 (AVX-512) and ISA the suffix the
+    functions are named with.
+*/
+#define ISA_CAT2(f, isa) f##_##isa
+#define ISA_CAT(f, isa) ISA_CAT2(f, isa)
+#define v_load ISA_CAT(v_load, ISA)
+#define v_storeu ISA_CAT(v_storeu, ISA)
+#define v_index ISA_CAT(v_index, ISA)
+#define v_filter ISA_CAT(v_filter, ISA)
+#define v_parity ISA_CAT(v_parity, ISA)
+#define v_store ISA_CAT(v_store, ISA)
+#define v_contribution ISA_CAT(v_contribution, ISA)
+#define extend_copy ISA_CAT(extend_copy, ISA)
+#define filter_scan ISA_CAT(filter_scan, ISA)
+#define rollback_bit_batch ISA_CAT(rollback_bit_batch, ISA)
+
+#if CRAPTO1_ISA == 3
+#define ISA_ATTR __attribute__((target("avx512f")))
+#define VLANES 16
+#define vec_t __m512i
+#define V1(x) _mm512_set1_epi32(x)
+#define NIB(c, x, s) _mm512_srlv_epi32(V1(c), \
+				       _mm512_and_si512(_mm512_srli_epi32(x, s), V1(0xf)))
+
+static inline ISA_ATTR vec_t v_load(const uint32_t *p)
+{
+	return _mm512_loadu_si512(p);
+}
+static inline ISA_ATTR void v_storeu(uint32_t *p, vec_t v)
+{
+	_mm512_storeu_si512(p, v);
+}
+static inline ISA_ATTR vec_t v_index(uint32_t i)
+{
+	return _mm512_add_epi32(V1(i), _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+						8, 9, 10, 11, 12, 13, 14, 15));
+}
+/** v_filter
+ * filter of every lane in bit 0, and of every lane | 1 in *f1
+ */
+static inline ISA_ATTR vec_t v_filter(vec_t x, vec_t *f1)
+{
+	vec_t n0 = _mm512_and_si512(x, V1(0xe)), g;
+
+	g = _mm512_and_si512(NIB(0x6c9c0, x, 4), V1(8));
+	g = _mm512_or_si512(g, _mm512_and_si512(NIB(0x3c8b0, x, 8), V1(4)));
+	g = _mm512_or_si512(g, _mm512_and_si512(NIB(0x1e458, x, 12), V1(2)));
+	g = _mm512_or_si512(g, _mm512_and_si512(NIB(0x0d938, x, 16), V1(1)));
+	*f1 = _mm512_or_si512(g, _mm512_and_si512(_mm512_srlv_epi32(V1(0xf22c0),
+		_mm512_or_si512(n0, V1(1))), V1(16)));
+	*f1 = _mm512_and_si512(_mm512_srlv_epi32(V1(0xEC57E80A), *f1), V1(1));
+	x = _mm512_and_si512(x, V1(0xf));
+	g = _mm512_or_si512(g, _mm512_and_si512(_mm512_srlv_epi32(V1(0xf22c0), x),
+						V1(16)));
+	return _mm512_and_si512(_mm512_srlv_epi32(V1(0xEC57E80A), g), V1(1));
+}
+static inline ISA_ATTR vec_t v_parity(vec_t x)
+{
+	x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 16));
+	x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 8));
+	x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 4));
+	x = _mm512_and_si512(x, V1(0xf));
+	return _mm512_and_si512(_mm512_srlv_epi32(V1(0x6996), x), V1(1));
+}
+/** v_store
+ * store the lanes whose bit 0 in m is set contiguously, returns their count
+ */
+static inline ISA_ATTR int v_store(uint32_t *dst, vec_t v, vec_t m)
+{
+	__mmask16 bits = _mm512_test_epi32_mask(m, V1(1));
+
+	_mm512_mask_compressstoreu_epi32(dst, bits, v);
+	return __builtin_popcount(bits);
+}
+#define v_and _mm512_and_si512
+#define v_or _mm512_or_si512
+#define v_xor _mm512_xor_si512
+#define v_andnot _mm512_andnot_si512
+#define v_shl _mm512_slli_epi32
+#define v_shr _mm512_srli_epi32
+#elif CRAPTO1_ISA == 2
+#define ISA_ATTR __attribute__((target("avx2")))
+#define VLANES 8
+#define vec_t __m256i
+#define V1(x) _mm256_set1_epi32(x)
+#define NIB(c, x, s) _mm256_srlv_epi32(V1(c), \
+				       _mm256_and_si256(_mm256_srli_epi32(x, s), V1(0xf)))
+
+static inline ISA_ATTR vec_t v_load(const uint32_t *p)
+{
+	return _mm256_loadu_si256((const __m256i *)p);
+}
+static inline ISA_ATTR void v_storeu(uint32_t *p, vec_t v)
+{
+	_mm256_storeu_si256((__m256i *)p, v);
+}
+static inline ISA_ATTR vec_t v_index(uint32_t i)
+{
+	return _mm256_add_epi32(V1(i), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+/** v_filter
+ * filter of every lane in bit 0, and of every lane | 1 in *f1
+ */
+static inline ISA_ATTR vec_t v_filter(vec_t x, vec_t *f1)
+{
+	vec_t n0 = _mm256_and_si256(x, V1(0xe)), g;
+
+	g = _mm256_and_si256(NIB(0x6c9c0, x, 4), V1(8));
+	g = _mm256_or_si256(g, _mm256_and_si256(NIB(0x3c8b0, x, 8), V1(4)));
+	g = _mm256_or_si256(g, _mm256_and_si256(NIB(0x1e458, x, 12), V1(2)));
+	g = _mm256_or_si256(g, _mm256_and_si256(NIB(0x0d938, x, 16), V1(1)));
+	*f1 = _mm256_or_si256(g, _mm256_and_si256(_mm256_srlv_epi32(V1(0xf22c0),
+		_mm256_or_si256(n0, V1(1))), V1(16)));
+	*f1 = _mm256_and_si256(_mm256_srlv_epi32(V1(0xEC57E80A), *f1), V1(1));
+	x = _mm256_and_si256(x, V1(0xf));
+	g = _mm256_or_si256(g, _mm256_and_si256(_mm256_srlv_epi32(V1(0xf22c0), x),
+						V1(16)));
+	return _mm256_and_si256(_mm256_srlv_epi32(V1(0xEC57E80A), g), V1(1));
+}
+static inline ISA_ATTR vec_t v_parity(vec_t x)
+{
+	x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+	x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 8));
+	x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 4));
+	x = _mm256_and_si256(x, V1(0xf));
+	return _mm256_and_si256(_mm256_srlv_epi32(V1(0x6996), x), V1(1));
+}
+/** v_store
+ * store the lanes whose bit 0 in m is set contiguously, returns their count
+ */
+static inline ISA_ATTR int v_store(uint32_t *dst, vec_t v, vec_t m)
+{
+	int bits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(m, 31)));
+	vec_t idx = _mm256_srlv_epi32(V1(compress_idx8[bits]),
+				      _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+
+	v = _mm256_permutevar8x32_epi32(v, _mm256_and_si256(idx, V1(7)));
+	_mm256_storeu_si256((__m256i *)dst, v);
+	return __builtin_popcount(bits);
+}
+#define v_and _mm256_and_si256
+#define v_or _mm256_or_si256
+#define v_xor _mm256_xor_si256
+#define v_andnot _mm256_andnot_si256
+#define v_shl _mm256_slli_epi32
+#define v_shr _mm256_srli_epi32
+#elif CRAPTO1_ISA == 1
+#define ISA_ATTR __attribute__((target("ssse3")))
+#define VLANES 4
+#define vec_t __m128i
+#define V1(x) _mm_set1_epi32(x)
+#define V8(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p) \
+	_mm_setr_epi8(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p)
+/* a nibble per lane in byte 0 looked up in 16 bytes, the rest cleared */
+#define NIB(t, x) _mm_and_si128(_mm_shuffle_epi8(t, x), V1(0xff))
+
+static inline ISA_ATTR vec_t v_load(const uint32_t *p)
+{
+	return _mm_loadu_si128((const __m128i *)p);
+}
+static inline ISA_ATTR void v_storeu(uint32_t *p, vec_t v)
+{
+	_mm_storeu_si128((__m128i *)p, v);
+}
+static inline ISA_ATTR vec_t v_index(uint32_t i)
+{
+	return _mm_add_epi32(V1(i), _mm_setr_epi32(0, 1, 2, 3));
+}
+/** v_filter
+ * filter of every lane in bit 0, and of every lane | 1 in *f1
+ */
+static inline ISA_ATTR vec_t v_filter(vec_t x, vec_t *f1)
+{
+	const vec_t fa = V8(0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16);
+	const vec_t fb = V8(0, 0, 0, 8, 8, 8, 0, 0, 8, 0, 0, 8, 8, 0, 8, 8);
+	const vec_t fc = V8(0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4);
+	const vec_t fd = V8(0, 0, 2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 2, 2, 2, 2);
+	const vec_t fe = V8(0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1);
+	const vec_t lo = V8(0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1);
+	const vec_t hi = V8(1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1);
+	const vec_t m = V1(0xf);
+	vec_t g, f0, s0, s1;
+
+	g = NIB(fb, _mm_and_si128(_mm_srli_epi32(x, 4), m));
+	g = _mm_or_si128(g, NIB(fc, _mm_and_si128(_mm_srli_epi32(x, 8), m)));
+	g = _mm_or_si128(g, NIB(fd, _mm_and_si128(_mm_srli_epi32(x, 12), m)));
+	g = _mm_or_si128(g, NIB(fe, _mm_and_si128(_mm_srli_epi32(x, 16), m)));
+	f0 = _mm_or_si128(g, NIB(fa, _mm_and_si128(x, m)));
+	*f1 = _mm_or_si128(g, NIB(fa, _mm_or_si128(_mm_and_si128(x, V1(0xe)),
+						   V1(1))));
+	s0 = _mm_cmpeq_epi32(_mm_and_si128(f0, V1(16)), V1(16));
+	s1 = _mm_cmpeq_epi32(_mm_and_si128(*f1, V1(16)), V1(16));
+	*f1 = _mm_or_si128(_mm_and_si128(s1, _mm_shuffle_epi8(hi, *f1)),
+			   _mm_andnot_si128(s1, _mm_shuffle_epi8(lo, *f1)));
+	*f1 = _mm_and_si128(*f1, V1(1));
+	f0 = _mm_or_si128(_mm_and_si128(s0, _mm_shuffle_epi8(hi, f0)),
+			  _mm_andnot_si128(s0, _mm_shuffle_epi8(lo, f0)));
+	return _mm_and_si128(f0, V1(1));
+}
+static inline ISA_ATTR vec_t v_parity(vec_t x)
+{
+	const vec_t p = V8(0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0);
+
+	x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+	x = _mm_xor_si128(x, _mm_srli_epi32(x, 8));
+	x = _mm_xor_si128(x, _mm_srli_epi32(x, 4));
+	return _mm_and_si128(_mm_shuffle_epi8(p, _mm_and_si128(x, V1(0xf))),
+			     V1(1));
+}
+/** v_store
+ * store the lanes whose bit 0 in m is set contiguously, returns their count
+ */
+static inline ISA_ATTR int v_store(uint32_t *dst, vec_t v, vec_t m)
+{
+	int bits = _mm_movemask_ps(_mm_castsi128_ps(_mm_slli_epi32(m, 31)));
+
+	v = _mm_shuffle_epi8(v, _mm_loadu_si128((const __m128i *)compress_idx4[bits]));
+	_mm_storeu_si128((__m128i *)dst, v);
+	return __builtin_popcount(bits);
+}
+#define v_and _mm_and_si128
+#define v_or _mm_or_si128
+#define v_xor _mm_xor_si128
+#define v_andnot _mm_andnot_si128
+#define v_shl _mm_slli_epi32
+#define v_shr _mm_srli_epi32
+#else
+#define ISA_ATTR
+#define VLANES 0
+#endif
+
+#if VLANES
+static inline ISA_ATTR vec_t v_contribution(vec_t x, uint32_t m1, uint32_t m2)
+{
+	vec_t p = v_shr(x, 25);
+
+	p = v_or(v_shl(p, 1), v_parity(v_and(x, V1(m1))));
+	p = v_or(v_shl(p, 1), v_parity(v_and(x, V1(m2))));
+	return v_or(v_shl(p, 24), v_and(x, V1(0xffffff)));
+}
+#endif
+/** extend_copy
+ * extend_table of the n entries at src into dst, or extend_table_simple with
+ * m1 0.  The survivors are in no particular order, returns their count.
+ * dst may run VLANES entries ahead of the entry being read in src.
+ */
+static ISA_ATTR size_t
+extend_copy(const uint32_t *src, size_t n, uint32_t *dst, int bit,
+	    uint32_t m1, uint32_t m2, uint32_t in)
+{
+	size_t i = 0, out = 0;
+#if VLANES
+	vec_t x, f0, f1, single, keep, fork;
+#endif
+
+	in <<= 24;
+#if VLANES
+	for(; i + VLANES <= n; i += VLANES) {
+		x = v_shl(v_load(src + i), 1);
+		f0 = v_filter(x, &f1);
+		single = v_xor(f0, f1);
+		f0 = v_xor(f0, V1(bit));
+		fork = v_andnot(v_or(single, f0), V1(1));
+		keep = v_or(single, fork);
+		f0 = v_or(x, v_and(single, f0));
+		f1 = v_or(x, V1(1));
+		if(m1) {
+			f0 = v_xor(v_contribution(f0, m1, m2), V1(in));
+			f1 = v_xor(v_contribution(f1, m1, m2), V1(in));
+		}
+		out += v_store(dst + out, f0, keep);
+		out += v_store(dst + out, f1, fork);
+	}
+#endif
+	for(; i < n; ++i)
+		out += extend_emit(dst + out, src[i], bit, m1, m2, in);
+	return out;
+}
+/** filter_scan
+ * the 20 bit values, and 1 << 20, whose filter is bit into dst, returns
+ * their count
+ */
+static ISA_ATTR size_t filter_scan(uint32_t *dst, int bit)
+{
+	uint32_t i = 0;
+	size_t out = 0;
+#if VLANES
+	vec_t f1;
+
+	for(; i < 1 << 20; i += VLANES)
+		out += v_store(dst + out, v_index(i),
+			       v_xor(v_filter(v_index(i), &f1), V1(!bit)));
+#endif
+	for(; i <= 1 << 20; ++i)
+		if((uint32_t)filter(i) == (uint32_t)bit)
+			dst[out++] = i;
+	return out;
+}
+/** rollback_bit_batch
+ * lfsr_rollback_bit with the keystream fed back on n states, the halves
+ * already masked to 24 bits
+ */
+static ISA_ATTR void
+rollback_bit_batch(uint32_t *odd, uint32_t *even, size_t n, uint32_t in)
+{
+	uint32_t o, e, b;
+	size_t i = 0;
+#if VLANES
+	vec_t vo, ve, vb, f1;
+
+	for(; i + VLANES <= n; i += VLANES) {
+		vo = v_load(odd + i);
+		ve = v_load(even + i);
+		vb = v_xor(v_and(vo, V1(1)), v_and(v_shr(vo, 1), V1(LF_POLY_EVEN)));
+		vb = v_parity(v_xor(vb, v_and(ve, V1(LF_POLY_ODD))));
+		vb = v_xor(v_xor(vb, v_filter(ve, &f1)), V1(in));
+		vo = v_or(v_shr(vo, 1), v_shl(vb, 23));
+		v_storeu(odd + i, ve);
+		v_storeu(even + i, vo);
+	}
+#endif
+	for(; i < n; ++i) {
+		o = odd[i];
+		e = even[i];
+		b = parity((o & 1) ^ (o >> 1 & LF_POLY_EVEN) ^ (e & LF_POLY_ODD));
+		b ^= filter(e) ^ in;
+		odd[i] = e;
+		even[i] = o >> 1 | b << 23;
+	}
+}
+
+#undef ISA_CAT2
+#undef ISA_CAT
+#undef v_load
+#undef v_storeu
+#undef v_index
+#undef v_filter
+#undef v_parity
+#undef v_store
+#undef v_contribution
+#undef extend_copy
+#undef filter_scan
+#undef rollback_bit_batch
+#undef ISA_ATTR
+#undef VLANES
+#undef vec_t
+#undef V1
+#undef V8
+#undef NIB
+#undef v_and
+#undef v_or
+#undef v_xor
+#undef v_andnot
+#undef v_shl
+#undef v_shr
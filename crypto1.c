@@ -19,10 +19,188 @@
 */
 #include "crapto1.h"
 #include <stdlib.h>
+#include <pthread.h>
 
 #define SWAPENDIAN(x)\
 	(x = (x >> 8 & 0xff00ff) | (x & 0xff00ff) << 8, x = x >> 16 | x << 16)
 
+/* Without the keystream fed back, 8 steps of the LFSR are linear in the
+ * state and the input.  The tables give the 8 new bits, the ones that end
+ * up in odd (n1 n3 n5 n7) in the high nibble and the ones that end up in
+ * even (n0 n2 n4 n6) in the low nibble, per byte of odd, even and input.
+ */
+static const uint8_t lfsr_byte_odd[3][256] = {
+	{
+		0x00, 0x23, 0x57, 0x74, 0xbe, 0x9d, 0xe9, 0xca, 0x2c, 0x0f, 0x7b, 0x58,
+		0x92, 0xb1, 0xc5, 0xe6, 0x3b, 0x18, 0x6c, 0x4f, 0x85, 0xa6, 0xd2, 0xf1,
+		0x17, 0x34, 0x40, 0x63, 0xa9, 0x8a, 0xfe, 0xdd, 0x14, 0x37, 0x43, 0x60,
+		0xaa, 0x89, 0xfd, 0xde, 0x38, 0x1b, 0x6f, 0x4c, 0x86, 0xa5, 0xd1, 0xf2,
+		0x2f, 0x0c, 0x78, 0x5b, 0x91, 0xb2, 0xc6, 0xe5, 0x03, 0x20, 0x54, 0x77,
+		0xbd, 0x9e, 0xea, 0xc9, 0x38, 0x1b, 0x6f, 0x4c, 0x86, 0xa5, 0xd1, 0xf2,
+		0x14, 0x37, 0x43, 0x60, 0xaa, 0x89, 0xfd, 0xde, 0x03, 0x20, 0x54, 0x77,
+		0xbd, 0x9e, 0xea, 0xc9, 0x2f, 0x0c, 0x78, 0x5b, 0x91, 0xb2, 0xc6, 0xe5,
+		0x2c, 0x0f, 0x7b, 0x58, 0x92, 0xb1, 0xc5, 0xe6, 0x00, 0x23, 0x57, 0x74,
+		0xbe, 0x9d, 0xe9, 0xca, 0x17, 0x34, 0x40, 0x63, 0xa9, 0x8a, 0xfe, 0xdd,
+		0x3b, 0x18, 0x6c, 0x4f, 0x85, 0xa6, 0xd2, 0xf1, 0x03, 0x20, 0x54, 0x77,
+		0xbd, 0x9e, 0xea, 0xc9, 0x2f, 0x0c, 0x78, 0x5b, 0x91, 0xb2, 0xc6, 0xe5,
+		0x38, 0x1b, 0x6f, 0x4c, 0x86, 0xa5, 0xd1, 0xf2, 0x14, 0x37, 0x43, 0x60,
+		0xaa, 0x89, 0xfd, 0xde, 0x17, 0x34, 0x40, 0x63, 0xa9, 0x8a, 0xfe, 0xdd,
+		0x3b, 0x18, 0x6c, 0x4f, 0x85, 0xa6, 0xd2, 0xf1, 0x2c, 0x0f, 0x7b, 0x58,
+		0x92, 0xb1, 0xc5, 0xe6, 0x00, 0x23, 0x57, 0x74, 0xbe, 0x9d, 0xe9, 0xca,
+		0x3b, 0x18, 0x6c, 0x4f, 0x85, 0xa6, 0xd2, 0xf1, 0x17, 0x34, 0x40, 0x63,
+		0xa9, 0x8a, 0xfe, 0xdd, 0x00, 0x23, 0x57, 0x74, 0xbe, 0x9d, 0xe9, 0xca,
+		0x2c, 0x0f, 0x7b, 0x58, 0x92, 0xb1, 0xc5, 0xe6, 0x2f, 0x0c, 0x78, 0x5b,
+		0x91, 0xb2, 0xc6, 0xe5, 0x03, 0x20, 0x54, 0x77, 0xbd, 0x9e, 0xea, 0xc9,
+		0x14, 0x37, 0x43, 0x60, 0xaa, 0x89, 0xfd, 0xde, 0x38, 0x1b, 0x6f, 0x4c,
+		0x86, 0xa5, 0xd1, 0xf2,
+	},
+	{
+		0x00, 0x07, 0x0f, 0x08, 0x6d, 0x6a, 0x62, 0x65, 0xa9, 0xae, 0xa6, 0xa1,
+		0xc4, 0xc3, 0xcb, 0xcc, 0x03, 0x04, 0x0c, 0x0b, 0x6e, 0x69, 0x61, 0x66,
+		0xaa, 0xad, 0xa5, 0xa2, 0xc7, 0xc0, 0xc8, 0xcf, 0x07, 0x00, 0x08, 0x0f,
+		0x6a, 0x6d, 0x65, 0x62, 0xae, 0xa9, 0xa1, 0xa6, 0xc3, 0xc4, 0xcc, 0xcb,
+		0x04, 0x03, 0x0b, 0x0c, 0x69, 0x6e, 0x66, 0x61, 0xad, 0xaa, 0xa2, 0xa5,
+		0xc0, 0xc7, 0xcf, 0xc8, 0x1f, 0x18, 0x10, 0x17, 0x72, 0x75, 0x7d, 0x7a,
+		0xb6, 0xb1, 0xb9, 0xbe, 0xdb, 0xdc, 0xd4, 0xd3, 0x1c, 0x1b, 0x13, 0x14,
+		0x71, 0x76, 0x7e, 0x79, 0xb5, 0xb2, 0xba, 0xbd, 0xd8, 0xdf, 0xd7, 0xd0,
+		0x18, 0x1f, 0x17, 0x10, 0x75, 0x72, 0x7a, 0x7d, 0xb1, 0xb6, 0xbe, 0xb9,
+		0xdc, 0xdb, 0xd3, 0xd4, 0x1b, 0x1c, 0x14, 0x13, 0x76, 0x71, 0x79, 0x7e,
+		0xb2, 0xb5, 0xbd, 0xba, 0xdf, 0xd8, 0xd0, 0xd7, 0x5d, 0x5a, 0x52, 0x55,
+		0x30, 0x37, 0x3f, 0x38, 0xf4, 0xf3, 0xfb, 0xfc, 0x99, 0x9e, 0x96, 0x91,
+		0x5e, 0x59, 0x51, 0x56, 0x33, 0x34, 0x3c, 0x3b, 0xf7, 0xf0, 0xf8, 0xff,
+		0x9a, 0x9d, 0x95, 0x92, 0x5a, 0x5d, 0x55, 0x52, 0x37, 0x30, 0x38, 0x3f,
+		0xf3, 0xf4, 0xfc, 0xfb, 0x9e, 0x99, 0x91, 0x96, 0x59, 0x5e, 0x56, 0x51,
+		0x34, 0x33, 0x3b, 0x3c, 0xf0, 0xf7, 0xff, 0xf8, 0x9d, 0x9a, 0x92, 0x95,
+		0x42, 0x45, 0x4d, 0x4a, 0x2f, 0x28, 0x20, 0x27, 0xeb, 0xec, 0xe4, 0xe3,
+		0x86, 0x81, 0x89, 0x8e, 0x41, 0x46, 0x4e, 0x49, 0x2c, 0x2b, 0x23, 0x24,
+		0xe8, 0xef, 0xe7, 0xe0, 0x85, 0x82, 0x8a, 0x8d, 0x45, 0x42, 0x4a, 0x4d,
+		0x28, 0x2f, 0x27, 0x20, 0xec, 0xeb, 0xe3, 0xe4, 0x81, 0x86, 0x8e, 0x89,
+		0x46, 0x41, 0x49, 0x4e, 0x2b, 0x2c, 0x24, 0x23, 0xef, 0xe8, 0xe0, 0xe7,
+		0x82, 0x85, 0x8d, 0x8a,
+	},
+	{
+		0x00, 0xc9, 0xd3, 0x1a, 0x84, 0x4d, 0x57, 0x9e, 0x3b, 0xf2, 0xe8, 0x21,
+		0xbf, 0x76, 0x6c, 0xa5, 0x04, 0xcd, 0xd7, 0x1e, 0x80, 0x49, 0x53, 0x9a,
+		0x3f, 0xf6, 0xec, 0x25, 0xbb, 0x72, 0x68, 0xa1, 0x19, 0xd0, 0xca, 0x03,
+		0x9d, 0x54, 0x4e, 0x87, 0x22, 0xeb, 0xf1, 0x38, 0xa6, 0x6f, 0x75, 0xbc,
+		0x1d, 0xd4, 0xce, 0x07, 0x99, 0x50, 0x4a, 0x83, 0x26, 0xef, 0xf5, 0x3c,
+		0xa2, 0x6b, 0x71, 0xb8, 0x40, 0x89, 0x93, 0x5a, 0xc4, 0x0d, 0x17, 0xde,
+		0x7b, 0xb2, 0xa8, 0x61, 0xff, 0x36, 0x2c, 0xe5, 0x44, 0x8d, 0x97, 0x5e,
+		0xc0, 0x09, 0x13, 0xda, 0x7f, 0xb6, 0xac, 0x65, 0xfb, 0x32, 0x28, 0xe1,
+		0x59, 0x90, 0x8a, 0x43, 0xdd, 0x14, 0x0e, 0xc7, 0x62, 0xab, 0xb1, 0x78,
+		0xe6, 0x2f, 0x35, 0xfc, 0x5d, 0x94, 0x8e, 0x47, 0xd9, 0x10, 0x0a, 0xc3,
+		0x66, 0xaf, 0xb5, 0x7c, 0xe2, 0x2b, 0x31, 0xf8, 0x91, 0x58, 0x42, 0x8b,
+		0x15, 0xdc, 0xc6, 0x0f, 0xaa, 0x63, 0x79, 0xb0, 0x2e, 0xe7, 0xfd, 0x34,
+		0x95, 0x5c, 0x46, 0x8f, 0x11, 0xd8, 0xc2, 0x0b, 0xae, 0x67, 0x7d, 0xb4,
+		0x2a, 0xe3, 0xf9, 0x30, 0x88, 0x41, 0x5b, 0x92, 0x0c, 0xc5, 0xdf, 0x16,
+		0xb3, 0x7a, 0x60, 0xa9, 0x37, 0xfe, 0xe4, 0x2d, 0x8c, 0x45, 0x5f, 0x96,
+		0x08, 0xc1, 0xdb, 0x12, 0xb7, 0x7e, 0x64, 0xad, 0x33, 0xfa, 0xe0, 0x29,
+		0xd1, 0x18, 0x02, 0xcb, 0x55, 0x9c, 0x86, 0x4f, 0xea, 0x23, 0x39, 0xf0,
+		0x6e, 0xa7, 0xbd, 0x74, 0xd5, 0x1c, 0x06, 0xcf, 0x51, 0x98, 0x82, 0x4b,
+		0xee, 0x27, 0x3d, 0xf4, 0x6a, 0xa3, 0xb9, 0x70, 0xc8, 0x01, 0x1b, 0xd2,
+		0x4c, 0x85, 0x9f, 0x56, 0xf3, 0x3a, 0x20, 0xe9, 0x77, 0xbe, 0xa4, 0x6d,
+		0xcc, 0x05, 0x1f, 0xd6, 0x48, 0x81, 0x9b, 0x52, 0xf7, 0x3e, 0x24, 0xed,
+		0x73, 0xba, 0xa0, 0x69,
+	},
+};
+static const uint8_t lfsr_byte_even[3][256] = {
+	{
+		0x00, 0x72, 0xe5, 0x97, 0xf8, 0x8a, 0x1d, 0x6f, 0xb1, 0xc3, 0x54, 0x26,
+		0x49, 0x3b, 0xac, 0xde, 0x40, 0x32, 0xa5, 0xd7, 0xb8, 0xca, 0x5d, 0x2f,
+		0xf1, 0x83, 0x14, 0x66, 0x09, 0x7b, 0xec, 0x9e, 0x81, 0xf3, 0x64, 0x16,
+		0x79, 0x0b, 0x9c, 0xee, 0x30, 0x42, 0xd5, 0xa7, 0xc8, 0xba, 0x2d, 0x5f,
+		0xc1, 0xb3, 0x24, 0x56, 0x39, 0x4b, 0xdc, 0xae, 0x70, 0x02, 0x95, 0xe7,
+		0x88, 0xfa, 0x6d, 0x1f, 0x30, 0x42, 0xd5, 0xa7, 0xc8, 0xba, 0x2d, 0x5f,
+		0x81, 0xf3, 0x64, 0x16, 0x79, 0x0b, 0x9c, 0xee, 0x70, 0x02, 0x95, 0xe7,
+		0x88, 0xfa, 0x6d, 0x1f, 0xc1, 0xb3, 0x24, 0x56, 0x39, 0x4b, 0xdc, 0xae,
+		0xb1, 0xc3, 0x54, 0x26, 0x49, 0x3b, 0xac, 0xde, 0x00, 0x72, 0xe5, 0x97,
+		0xf8, 0x8a, 0x1d, 0x6f, 0xf1, 0x83, 0x14, 0x66, 0x09, 0x7b, 0xec, 0x9e,
+		0x40, 0x32, 0xa5, 0xd7, 0xb8, 0xca, 0x5d, 0x2f, 0x70, 0x02, 0x95, 0xe7,
+		0x88, 0xfa, 0x6d, 0x1f, 0xc1, 0xb3, 0x24, 0x56, 0x39, 0x4b, 0xdc, 0xae,
+		0x30, 0x42, 0xd5, 0xa7, 0xc8, 0xba, 0x2d, 0x5f, 0x81, 0xf3, 0x64, 0x16,
+		0x79, 0x0b, 0x9c, 0xee, 0xf1, 0x83, 0x14, 0x66, 0x09, 0x7b, 0xec, 0x9e,
+		0x40, 0x32, 0xa5, 0xd7, 0xb8, 0xca, 0x5d, 0x2f, 0xb1, 0xc3, 0x54, 0x26,
+		0x49, 0x3b, 0xac, 0xde, 0x00, 0x72, 0xe5, 0x97, 0xf8, 0x8a, 0x1d, 0x6f,
+		0x40, 0x32, 0xa5, 0xd7, 0xb8, 0xca, 0x5d, 0x2f, 0xf1, 0x83, 0x14, 0x66,
+		0x09, 0x7b, 0xec, 0x9e, 0x00, 0x72, 0xe5, 0x97, 0xf8, 0x8a, 0x1d, 0x6f,
+		0xb1, 0xc3, 0x54, 0x26, 0x49, 0x3b, 0xac, 0xde, 0xc1, 0xb3, 0x24, 0x56,
+		0x39, 0x4b, 0xdc, 0xae, 0x70, 0x02, 0x95, 0xe7, 0x88, 0xfa, 0x6d, 0x1f,
+		0x81, 0xf3, 0x64, 0x16, 0x79, 0x0b, 0x9c, 0xee, 0x30, 0x42, 0xd5, 0xa7,
+		0xc8, 0xba, 0x2d, 0x5f,
+	},
+	{
+		0x00, 0xf0, 0xd3, 0x23, 0x95, 0x65, 0x46, 0xb6, 0x09, 0xf9, 0xda, 0x2a,
+		0x9c, 0x6c, 0x4f, 0xbf, 0x70, 0x80, 0xa3, 0x53, 0xe5, 0x15, 0x36, 0xc6,
+		0x79, 0x89, 0xaa, 0x5a, 0xec, 0x1c, 0x3f, 0xcf, 0xf0, 0x00, 0x23, 0xd3,
+		0x65, 0x95, 0xb6, 0x46, 0xf9, 0x09, 0x2a, 0xda, 0x6c, 0x9c, 0xbf, 0x4f,
+		0x80, 0x70, 0x53, 0xa3, 0x15, 0xe5, 0xc6, 0x36, 0x89, 0x79, 0x5a, 0xaa,
+		0x1c, 0xec, 0xcf, 0x3f, 0xd2, 0x22, 0x01, 0xf1, 0x47, 0xb7, 0x94, 0x64,
+		0xdb, 0x2b, 0x08, 0xf8, 0x4e, 0xbe, 0x9d, 0x6d, 0xa2, 0x52, 0x71, 0x81,
+		0x37, 0xc7, 0xe4, 0x14, 0xab, 0x5b, 0x78, 0x88, 0x3e, 0xce, 0xed, 0x1d,
+		0x22, 0xd2, 0xf1, 0x01, 0xb7, 0x47, 0x64, 0x94, 0x2b, 0xdb, 0xf8, 0x08,
+		0xbe, 0x4e, 0x6d, 0x9d, 0x52, 0xa2, 0x81, 0x71, 0xc7, 0x37, 0x14, 0xe4,
+		0x5b, 0xab, 0x88, 0x78, 0xce, 0x3e, 0x1d, 0xed, 0x96, 0x66, 0x45, 0xb5,
+		0x03, 0xf3, 0xd0, 0x20, 0x9f, 0x6f, 0x4c, 0xbc, 0x0a, 0xfa, 0xd9, 0x29,
+		0xe6, 0x16, 0x35, 0xc5, 0x73, 0x83, 0xa0, 0x50, 0xef, 0x1f, 0x3c, 0xcc,
+		0x7a, 0x8a, 0xa9, 0x59, 0x66, 0x96, 0xb5, 0x45, 0xf3, 0x03, 0x20, 0xd0,
+		0x6f, 0x9f, 0xbc, 0x4c, 0xfa, 0x0a, 0x29, 0xd9, 0x16, 0xe6, 0xc5, 0x35,
+		0x83, 0x73, 0x50, 0xa0, 0x1f, 0xef, 0xcc, 0x3c, 0x8a, 0x7a, 0x59, 0xa9,
+		0x44, 0xb4, 0x97, 0x67, 0xd1, 0x21, 0x02, 0xf2, 0x4d, 0xbd, 0x9e, 0x6e,
+		0xd8, 0x28, 0x0b, 0xfb, 0x34, 0xc4, 0xe7, 0x17, 0xa1, 0x51, 0x72, 0x82,
+		0x3d, 0xcd, 0xee, 0x1e, 0xa8, 0x58, 0x7b, 0x8b, 0xb4, 0x44, 0x67, 0x97,
+		0x21, 0xd1, 0xf2, 0x02, 0xbd, 0x4d, 0x6e, 0x9e, 0x28, 0xd8, 0xfb, 0x0b,
+		0xc4, 0x34, 0x17, 0xe7, 0x51, 0xa1, 0x82, 0x72, 0xcd, 0x3d, 0x1e, 0xee,
+		0x58, 0xa8, 0x8b, 0x7b,
+	},
+	{
+		0x00, 0x0f, 0x7d, 0x72, 0x88, 0x87, 0xf5, 0xfa, 0x40, 0x4f, 0x3d, 0x32,
+		0xc8, 0xc7, 0xb5, 0xba, 0x90, 0x9f, 0xed, 0xe2, 0x18, 0x17, 0x65, 0x6a,
+		0xd0, 0xdf, 0xad, 0xa2, 0x58, 0x57, 0x25, 0x2a, 0x02, 0x0d, 0x7f, 0x70,
+		0x8a, 0x85, 0xf7, 0xf8, 0x42, 0x4d, 0x3f, 0x30, 0xca, 0xc5, 0xb7, 0xb8,
+		0x92, 0x9d, 0xef, 0xe0, 0x1a, 0x15, 0x67, 0x68, 0xd2, 0xdd, 0xaf, 0xa0,
+		0x5a, 0x55, 0x27, 0x28, 0x14, 0x1b, 0x69, 0x66, 0x9c, 0x93, 0xe1, 0xee,
+		0x54, 0x5b, 0x29, 0x26, 0xdc, 0xd3, 0xa1, 0xae, 0x84, 0x8b, 0xf9, 0xf6,
+		0x0c, 0x03, 0x71, 0x7e, 0xc4, 0xcb, 0xb9, 0xb6, 0x4c, 0x43, 0x31, 0x3e,
+		0x16, 0x19, 0x6b, 0x64, 0x9e, 0x91, 0xe3, 0xec, 0x56, 0x59, 0x2b, 0x24,
+		0xde, 0xd1, 0xa3, 0xac, 0x86, 0x89, 0xfb, 0xf4, 0x0e, 0x01, 0x73, 0x7c,
+		0xc6, 0xc9, 0xbb, 0xb4, 0x4e, 0x41, 0x33, 0x3c, 0x39, 0x36, 0x44, 0x4b,
+		0xb1, 0xbe, 0xcc, 0xc3, 0x79, 0x76, 0x04, 0x0b, 0xf1, 0xfe, 0x8c, 0x83,
+		0xa9, 0xa6, 0xd4, 0xdb, 0x21, 0x2e, 0x5c, 0x53, 0xe9, 0xe6, 0x94, 0x9b,
+		0x61, 0x6e, 0x1c, 0x13, 0x3b, 0x34, 0x46, 0x49, 0xb3, 0xbc, 0xce, 0xc1,
+		0x7b, 0x74, 0x06, 0x09, 0xf3, 0xfc, 0x8e, 0x81, 0xab, 0xa4, 0xd6, 0xd9,
+		0x23, 0x2c, 0x5e, 0x51, 0xeb, 0xe4, 0x96, 0x99, 0x63, 0x6c, 0x1e, 0x11,
+		0x2d, 0x22, 0x50, 0x5f, 0xa5, 0xaa, 0xd8, 0xd7, 0x6d, 0x62, 0x10, 0x1f,
+		0xe5, 0xea, 0x98, 0x97, 0xbd, 0xb2, 0xc0, 0xcf, 0x35, 0x3a, 0x48, 0x47,
+		0xfd, 0xf2, 0x80, 0x8f, 0x75, 0x7a, 0x08, 0x07, 0x2f, 0x20, 0x52, 0x5d,
+		0xa7, 0xa8, 0xda, 0xd5, 0x6f, 0x60, 0x12, 0x1d, 0xe7, 0xe8, 0x9a, 0x95,
+		0xbf, 0xb0, 0xc2, 0xcd, 0x37, 0x38, 0x4a, 0x45, 0xff, 0xf0, 0x82, 0x8d,
+		0x77, 0x78, 0x0a, 0x05,
+	},
+};
+static const uint8_t lfsr_byte_in[256] = {
+	0x00, 0x39, 0x91, 0xa8, 0x14, 0x2d, 0x85, 0xbc, 0x40, 0x79, 0xd1, 0xe8,
+	0x54, 0x6d, 0xc5, 0xfc, 0x02, 0x3b, 0x93, 0xaa, 0x16, 0x2f, 0x87, 0xbe,
+	0x42, 0x7b, 0xd3, 0xea, 0x56, 0x6f, 0xc7, 0xfe, 0x20, 0x19, 0xb1, 0x88,
+	0x34, 0x0d, 0xa5, 0x9c, 0x60, 0x59, 0xf1, 0xc8, 0x74, 0x4d, 0xe5, 0xdc,
+	0x22, 0x1b, 0xb3, 0x8a, 0x36, 0x0f, 0xa7, 0x9e, 0x62, 0x5b, 0xf3, 0xca,
+	0x76, 0x4f, 0xe7, 0xde, 0x01, 0x38, 0x90, 0xa9, 0x15, 0x2c, 0x84, 0xbd,
+	0x41, 0x78, 0xd0, 0xe9, 0x55, 0x6c, 0xc4, 0xfd, 0x03, 0x3a, 0x92, 0xab,
+	0x17, 0x2e, 0x86, 0xbf, 0x43, 0x7a, 0xd2, 0xeb, 0x57, 0x6e, 0xc6, 0xff,
+	0x21, 0x18, 0xb0, 0x89, 0x35, 0x0c, 0xa4, 0x9d, 0x61, 0x58, 0xf0, 0xc9,
+	0x75, 0x4c, 0xe4, 0xdd, 0x23, 0x1a, 0xb2, 0x8b, 0x37, 0x0e, 0xa6, 0x9f,
+	0x63, 0x5a, 0xf2, 0xcb, 0x77, 0x4e, 0xe6, 0xdf, 0x10, 0x29, 0x81, 0xb8,
+	0x04, 0x3d, 0x95, 0xac, 0x50, 0x69, 0xc1, 0xf8, 0x44, 0x7d, 0xd5, 0xec,
+	0x12, 0x2b, 0x83, 0xba, 0x06, 0x3f, 0x97, 0xae, 0x52, 0x6b, 0xc3, 0xfa,
+	0x46, 0x7f, 0xd7, 0xee, 0x30, 0x09, 0xa1, 0x98, 0x24, 0x1d, 0xb5, 0x8c,
+	0x70, 0x49, 0xe1, 0xd8, 0x64, 0x5d, 0xf5, 0xcc, 0x32, 0x0b, 0xa3, 0x9a,
+	0x26, 0x1f, 0xb7, 0x8e, 0x72, 0x4b, 0xe3, 0xda, 0x66, 0x5f, 0xf7, 0xce,
+	0x11, 0x28, 0x80, 0xb9, 0x05, 0x3c, 0x94, 0xad, 0x51, 0x68, 0xc0, 0xf9,
+	0x45, 0x7c, 0xd4, 0xed, 0x13, 0x2a, 0x82, 0xbb, 0x07, 0x3e, 0x96, 0xaf,
+	0x53, 0x6a, 0xc2, 0xfb, 0x47, 0x7e, 0xd6, 0xef, 0x31, 0x08, 0xa0, 0x99,
+	0x25, 0x1c, 0xb4, 0x8d, 0x71, 0x48, 0xe0, 0xd9, 0x65, 0x5c, 0xf4, 0xcd,
+	0x33, 0x0a, 0xa2, 0x9b, 0x27, 0x1e, 0xb6, 0x8f, 0x73, 0x4a, 0xe2, 0xdb,
+	0x67, 0x5e, 0xf6, 0xcf,
+};
 struct Crypto1State * crypto1_create(uint64_t key)
 {
 	struct Crypto1State *s = malloc(sizeof(*s));
@@ -46,6 +224,31 @@ void crypto1_get_lfsr(struct Crypto1State *state, uint64_t *lfsr)
 		*lfsr = *lfsr << 1 | BIT(state->even, i ^ 3);
 	}
 }
+/** spread24
+ * bit i ^ 3 of x to bit 2i, for the interleaving of crypto1_get_lfsr
+ */
+static inline uint64_t spread24(uint64_t x)
+{
+	x = (x & 0x555555) << 1 | (x >> 1 & 0x555555);
+	x = (x & 0x333333) << 2 | (x >> 2 & 0x333333);
+	x = (x | x << 16) & 0x0000ffff0000ffffULL;
+	x = (x | x << 8) & 0x00ff00ff00ff00ffULL;
+	x = (x | x << 4) & 0x0f0f0f0f0f0f0f0fULL;
+	x = (x | x << 2) & 0x3333333333333333ULL;
+	return (x | x << 1) & 0x5555555555555555ULL;
+}
+/** crypto1_get_lfsr_batch
+ * crypto1_get_lfsr of n states held as separate odd and even halves
+ */
+void crypto1_get_lfsr_batch(const uint32_t *odd, const uint32_t *even,
+			    size_t n, uint64_t *lfsr)
+{
+	size_t i;
+
+	for(i = 0; i < n; ++i)
+		lfsr[i] = spread24(odd[i] & 0xffffff) << 1 |
+			  spread24(even[i] & 0xffffff);
+}
 uint8_t crypto1_bit(struct Crypto1State *s, uint8_t in, int is_encrypted)
 {
 	uint32_t feedin;
@@ -61,10 +264,42 @@ uint8_t crypto1_bit(struct Crypto1State *s, uint8_t in, int is_encrypted)
 
 	return ret;
 }
+/** crypto1_byte_plain
+ * crypto1_byte for is_encrypted == 0, the feedback taken from the tables
+ * and the 8 filter inputs rebuilt from the old state and the new bits
+ */
+static inline uint8_t crypto1_byte_plain(struct Crypto1State *s, uint8_t in)
+{
+	uint32_t o = s->odd, e = s->even, n, no, ne;
+	uint8_t ret;
+
+	n  = lfsr_byte_odd[0][o & 0xff] ^ lfsr_byte_odd[1][o >> 8 & 0xff];
+	n ^= lfsr_byte_odd[2][o >> 16 & 0xff] ^ lfsr_byte_even[0][e & 0xff];
+	n ^= lfsr_byte_even[1][e >> 8 & 0xff] ^ lfsr_byte_even[2][e >> 16 & 0xff];
+	n ^= lfsr_byte_in[in];
+	no = n >> 4;
+	ne = n & 0xf;
+
+	ret  = filter(o);
+	ret |= filter(e << 1 | ne >> 3) << 1;
+	ret |= filter(o << 1 | no >> 3) << 2;
+	ret |= filter(e << 2 | ne >> 2) << 3;
+	ret |= filter(o << 2 | no >> 2) << 4;
+	ret |= filter(e << 3 | ne >> 1) << 5;
+	ret |= filter(o << 3 | no >> 1) << 6;
+	ret |= filter(e << 4 | ne) << 7;
+
+	s->odd = o << 4 | no;
+	s->even = e << 4 | ne;
+	return ret;
+}
 uint8_t crypto1_byte(struct Crypto1State *s, uint8_t in, int is_encrypted)
 {
 	uint8_t i, ret = 0;
 
+	if(!is_encrypted)
+		return crypto1_byte_plain(s, in);
+
 	for (i = 0; i < 8; ++i)
 		ret |= crypto1_bit(s, BIT(in, i), is_encrypted) << i;
 
@@ -74,11 +309,33 @@ uint32_t crypto1_word(struct Crypto1State *s, uint32_t in, int is_encrypted)
 {
 	uint32_t i, ret = 0;
 
+	if(!is_encrypted) {
+		for (i = 0; i < 32; i += 8)
+			ret |= (uint32_t)crypto1_byte_plain(s, in >> (24 - i)) <<
+			       (24 - i);
+		return ret;
+	}
+
 	for (i = 0; i < 32; ++i)
 		ret |= crypto1_bit(s, BEBIT(in, i), is_encrypted) << (i ^ 24);
 
 	return ret;
 }
+/** crypto1_keystream
+ * n bytes of keystream with nothing fed in.  When par is not 0, par[i]
+ * gets the keystream bit that encrypts the parity bit of byte i.
+ */
+void crypto1_keystream(struct Crypto1State *s, uint8_t *ks, uint8_t *par,
+		       size_t n)
+{
+	size_t i;
+
+	for(i = 0; i < n; ++i) {
+		ks[i] = crypto1_byte_plain(s, 0);
+		if(par)
+			par[i] = filter(s->odd);
+	}
+}
 
 /* prng_successor
  * helper used to obscure the keystream during authentication
@@ -91,3 +348,167 @@ uint32_t prng_successor(uint32_t x, uint32_t n)
 
 	return SWAPENDIAN(x);
 }
+
+/* position of every non zero state of the 16 bit tag PRNG on its cycle of
+ * 65535, and the state at every position, in the byte swapped domain
+ */
+static uint16_t prng_pos[1 << 16], prng_seq[65535];
+static pthread_once_t prng_once = PTHREAD_ONCE_INIT;
+
+static void prng_init(void)
+{
+	uint32_t u = 1, i;
+
+	for(i = 0; i < 65535; ++i) {
+		prng_seq[i] = u;
+		prng_pos[u] = i;
+		u = (u >> 1 | (u ^ u >> 2 ^ u >> 3 ^ u >> 5) << 15) & 0xffff;
+	}
+}
+/** prng_step
+ * prng_successor in the byte swapped domain, where the high half of x is
+ * the PRNG state and the low half what it shifted out over the last 16
+ * steps: R_n = U_n << 16 | (n < 16 ? R_0 >> n : U_(n - 16))
+ */
+static inline uint32_t prng_step(uint32_t x, uint32_t n)
+{
+	uint32_t p;
+
+	if(!(x >> 16))
+		return n < 32 ? x >> n : 0;
+
+	p = prng_pos[x >> 16] + n % 65535;
+	x = n < 16 ? x >> n & 0xffff : prng_seq[(p - 16 + 65535) % 65535];
+	return (uint32_t)prng_seq[p % 65535] << 16 | x;
+}
+/** prng_jump
+ * prng_successor in constant time, from the tables of PRNG positions
+ */
+uint32_t prng_jump(uint32_t x, uint32_t n)
+{
+	pthread_once(&prng_once, prng_init);
+
+	SWAPENDIAN(x);
+	x = prng_step(x, n);
+	return SWAPENDIAN(x);
+}
+/** prng_jump_batch
+ * out[i] = prng_successor(x[i], n) for len nonces, out may be x
+ */
+void prng_jump_batch(uint32_t *out, const uint32_t *x, size_t len, uint32_t n)
+{
+	uint32_t y;
+	size_t i;
+
+	pthread_once(&prng_once, prng_init);
+
+	for(i = 0; i < len; ++i) {
+		y = x[i];
+		SWAPENDIAN(y);
+		y = prng_step(y, n);
+		out[i] = SWAPENDIAN(y);
+	}
+}
+
+/* the LFSR with nothing fed in is linear and of period 2^48 - 1, with the
+ * state packed as odd << 24 | even.  lfsr_pow[0][k][j] is column j of the
+ * matrix that clocks it 2^k times, lfsr_pow[1][k][j] of the one that rolls
+ * it back 2^k times.
+ */
+#define LFSR_PERIOD ((1ULL << 48) - 1)
+static uint64_t lfsr_pow[2][48][48];
+static pthread_once_t lfsr_pow_once = PTHREAD_ONCE_INIT;
+
+static inline uint64_t lfsr_apply(const uint64_t *col, uint64_t v)
+{
+	uint64_t r = 0;
+
+	for(; v; v &= v - 1)
+		r ^= col[__builtin_ctzll(v)];
+	return r;
+}
+static void lfsr_pow_init(void)
+{
+	uint32_t o, e;
+	int d, j, k;
+
+	for(j = 0; j < 48; ++j) {
+		o = j < 24 ? 0 : 1 << (j - 24);
+		e = j < 24 ? 1 << j : 0;
+		e = e << 1 | parity((o & LF_POLY_ODD) ^ (e & LF_POLY_EVEN));
+		lfsr_pow[0][0][j] = (uint64_t)(e & 0xffffff) << 24 | o;
+
+		o = j < 24 ? 0 : 1 << (j - 24);
+		e = j < 24 ? 1 << j : 0;
+		o = o >> 1 | parity((o & 1) ^ (LF_POLY_EVEN & o >> 1) ^
+				    (LF_POLY_ODD & e)) << 23;
+		lfsr_pow[1][0][j] = (uint64_t)e << 24 | o;
+	}
+	for(d = 0; d < 2; ++d)
+		for(k = 1; k < 48; ++k)
+			for(j = 0; j < 48; ++j)
+				lfsr_pow[d][k][j] =
+					lfsr_apply(lfsr_pow[d][k - 1],
+						   lfsr_pow[d][k - 1][j]);
+}
+/** lfsr_jump
+ * the packed state v clocked n times forwards, or back when back is set
+ */
+static uint64_t lfsr_jump(uint64_t v, uint64_t n, int back)
+{
+	int k;
+
+	pthread_once(&lfsr_pow_once, lfsr_pow_init);
+
+	for(n %= LFSR_PERIOD, k = 0; n; ++k, n >>= 1)
+		if(n & 1)
+			v = lfsr_apply(lfsr_pow[back][k], v);
+	return v;
+}
+/** crypto1_jump
+ * the state after n calls of crypto1_bit(s, 0, 0), in O(log n), leaving
+ * only the 24 bits of each half that make up the state
+ */
+void crypto1_jump(struct Crypto1State *s, uint64_t n)
+{
+	uint64_t v = (uint64_t)(s->odd & 0xffffff) << 24 | (s->even & 0xffffff);
+
+	v = lfsr_jump(v, n, 0);
+	s->odd = v >> 24;
+	s->even = v & 0xffffff;
+}
+/** lfsr_rollback_jump
+ * the state after n calls of lfsr_rollback_bit(s, 0, 0), in O(log n)
+ */
+void lfsr_rollback_jump(struct Crypto1State *s, uint64_t n)
+{
+	uint64_t v = (uint64_t)(s->odd & 0xffffff) << 24 | (s->even & 0xffffff);
+
+	v = lfsr_jump(v, n, 1);
+	s->odd = v >> 24;
+	s->even = v & 0xffffff;
+}
+/** crypto1_fastfwd
+ * for c < 1 << bits, the difference odd[c], even[c] the state shows n clocks
+ * after c was fed in by its last bits calls of crypto1_bit, least
+ * significant bit first, with is_encrypted == 0 and bits < 32.  The
+ * darkside tables are crypto1_fastfwd(odd, even, 3, 35), for the last three
+ * bits of Nr.
+ */
+void crypto1_fastfwd(uint32_t *odd, uint32_t *even, int bits, uint64_t n)
+{
+	uint64_t v, unit[32];
+	uint32_t c;
+	int j;
+
+	for(j = 0; j < bits; ++j)
+		unit[j] = lfsr_jump(1ULL << 24,
+				    n % LFSR_PERIOD + bits - 1 - j, 0);
+
+	for(c = 0; c < 1u << bits; ++c) {
+		for(v = 0, j = 0; j < bits; ++j)
+			v ^= BIT(c, j) ? unit[j] : 0;
+		odd[c] = v >> 24;
+		even[c] = v & 0xffffff;
+	}
+}
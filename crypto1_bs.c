@@ -0,0 +1,217 @@
+/*  crypto1_bs.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+*/
+#include "crypto1_bs.h"
+#include <string.h>
+
+static inline void bs_setlane(bitslice_t *p, int lane, int v)
+{
+	uint64_t m = (uint64_t)1 << (lane & 63);
+
+	BS_WORD(*p, lane >> 6) = (BS_WORD(*p, lane >> 6) & ~m) | (v ? m : 0);
+}
+
+void crypto1_bs_init(struct Crypto1BS *bs)
+{
+	memset(bs, 0, sizeof(*bs));
+}
+/** crypto1_bs_set
+ * load a scalar state into one lane
+ */
+void crypto1_bs_set(struct Crypto1BS *bs, int lane, const struct Crypto1State *s)
+{
+	bitslice_t *p = bs->lfsr + bs->t;
+	int k;
+
+	for(k = 0; k < 24; ++k) {
+		bs_setlane(p + 47 - 2 * k, lane, BIT(s->odd, k));
+		bs_setlane(p + 46 - 2 * k, lane, BIT(s->even, k));
+	}
+}
+/** crypto1_bs_get
+ * extract the (24 bit masked) scalar state of one lane
+ */
+void crypto1_bs_get(const struct Crypto1BS *bs, int lane, struct Crypto1State *s)
+{
+	const bitslice_t *p = bs->lfsr + bs->t;
+	int k;
+
+	for(s->odd = s->even = 0, k = 23; k >= 0; --k) {
+		s->odd = s->odd << 1 | BS_LANE(p[47 - 2 * k], lane);
+		s->even = s->even << 1 | BS_LANE(p[46 - 2 * k], lane);
+	}
+}
+/** crypto1_bs_set_key
+ * equivalent of crypto1_create for a single lane
+ */
+void crypto1_bs_set_key(struct Crypto1BS *bs, int lane, uint64_t key)
+{
+	bitslice_t *p = bs->lfsr + bs->t;
+	int i;
+
+	for(i = 0; i < 48; ++i)
+		bs_setlane(p + 47 - i, lane, BIT(key, i ^ 7));
+}
+/** crypto1_bs_set_keys
+ * crypto1_bs_set_key for all lanes at once, key[i] is the plane of key bit i
+ */
+void crypto1_bs_set_keys(struct Crypto1BS *bs, const bitslice_t key[48])
+{
+	bitslice_t *p = bs->lfsr + bs->t;
+	int i;
+
+	for(i = 0; i < 48; ++i)
+		p[47 - i] = key[i ^ 7];
+}
+/** crypto1_bs_bit
+ * crypto1_bit for every lane, in and the returned keystream are bit planes
+ */
+bitslice_t crypto1_bs_bit(struct Crypto1BS *bs, bitslice_t in, int is_encrypted)
+{
+	bitslice_t *p = bs->lfsr + bs->t, ret = filter_bs(p), feedin;
+
+	feedin  = is_encrypted ? ret ^ in : in;
+	feedin ^= p[0] ^ p[5] ^ p[9] ^ p[10] ^ p[12] ^ p[14];
+	feedin ^= p[15] ^ p[17] ^ p[19] ^ p[24] ^ p[25] ^ p[27];
+	feedin ^= p[29] ^ p[35] ^ p[39] ^ p[41] ^ p[42] ^ p[43];
+	p[48] = feedin;
+
+	if(++bs->t == CRYPTO1_BS_WINDOW) {
+		memcpy(bs->lfsr, bs->lfsr + CRYPTO1_BS_WINDOW, 48 * sizeof(*p));
+		bs->t = 0;
+	}
+	return ret;
+}
+/** crypto1_bs_byte
+ * in[i] and out[i] are the planes of bit i, in may be 0 for no input
+ */
+void crypto1_bs_byte(struct Crypto1BS *bs, const bitslice_t *in,
+		     int is_encrypted, bitslice_t *out)
+{
+	int i;
+
+	for(i = 0; i < 8; ++i)
+		out[i] = crypto1_bs_bit(bs, in ? in[i] : BS_ZERO, is_encrypted);
+}
+/** crypto1_bs_word
+ * same bit order as crypto1_word, in[i] and out[i] are the planes of bit i
+ */
+void crypto1_bs_word(struct Crypto1BS *bs, const bitslice_t *in,
+		     int is_encrypted, bitslice_t *out)
+{
+	int i;
+
+	for(i = 0; i < 32; ++i)
+		out[i ^ 24] = crypto1_bs_bit(bs, in ? in[i ^ 24] : BS_ZERO,
+					     is_encrypted);
+}
+/** crypto1_bs_keystream
+ * n bits of plain keystream, nothing fed in
+ */
+void crypto1_bs_keystream(struct Crypto1BS *bs, bitslice_t *ks, size_t n)
+{
+	while(n--)
+		*ks++ = crypto1_bs_bit(bs, BS_ZERO, 0);
+}
+/** crypto1_bs_auth_match
+ * run the reader side of an authentication from freshly keyed lanes and
+ * return the lanes whose keystream at {ar} equals ks2.  Gives up as soon
+ * as every lane has mismatched, leaving the states part way.
+ */
+bitslice_t crypto1_bs_auth_match(struct Crypto1BS *bs, uint32_t uid_nt,
+				 uint32_t nr_enc, uint32_t ks2)
+{
+	bitslice_t match = BS_ONES, any;
+	int i, j;
+
+	for(i = 0; i < 32; ++i)
+		crypto1_bs_bit(bs, BEBIT(uid_nt, i) ? BS_ONES : BS_ZERO, 0);
+	for(i = 0; i < 32; ++i)
+		crypto1_bs_bit(bs, BEBIT(nr_enc, i) ? BS_ONES : BS_ZERO, 1);
+	for(i = 0; i < 32; ++i) {
+		match &= crypto1_bs_bit(bs, BS_ZERO, 0) ^
+			 (BEBIT(ks2, i) ? BS_ZERO : BS_ONES);
+		if(i & 3)
+			continue;
+		for(any = BS_ZERO, j = 0; j < CRYPTO1_BS_BITS / 64; ++j)
+			BS_WORD(any, 0) |= BS_WORD(match, j);
+		if(!BS_WORD(any, 0))
+			break;
+	}
+	return match;
+}
+
+/** crypto1_bs_spread
+ * the same 32 bit word in every lane
+ */
+void crypto1_bs_spread(bitslice_t planes[32], uint32_t x)
+{
+	int i;
+
+	for(i = 0; i < 32; ++i)
+		planes[i] = BIT(x, i) ? BS_ONES : BS_ZERO;
+}
+/** transpose64
+ * bit l of a[i] and bit i of a[l] trade places, six rounds of swapping
+ * ever smaller blocks instead of 4096 single bits
+ */
+static void transpose64(uint64_t a[64])
+{
+	uint64_t m = 0x00000000ffffffffULL, t;
+	int j, k;
+
+	for(j = 32; j; j >>= 1, m ^= m << j)
+		for(k = 0; k < 64; k = (k + j + 1) & ~j) {
+			t = (a[k] >> j ^ a[k + j]) & m;
+			a[k] ^= t << j;
+			a[k + j] ^= t;
+		}
+}
+/** crypto1_bs_pack
+ * transpose CRYPTO1_BS_LANES words into 32 planes
+ */
+void crypto1_bs_pack(bitslice_t planes[32], const uint32_t *x)
+{
+	uint64_t a[64];
+	int i, w;
+
+	for(w = 0; w < CRYPTO1_BS_LANES / 64; ++w) {
+		for(i = 0; i < 64; ++i)
+			a[i] = x[w * 64 + i];
+		transpose64(a);
+		for(i = 0; i < 32; ++i)
+			BS_WORD(planes[i], w) = a[i];
+	}
+}
+/** crypto1_bs_unpack
+ * transpose 32 planes back into CRYPTO1_BS_LANES words
+ */
+void crypto1_bs_unpack(uint32_t *x, const bitslice_t planes[32])
+{
+	uint64_t a[64];
+	int i, w;
+
+	for(w = 0; w < CRYPTO1_BS_LANES / 64; ++w) {
+		for(i = 0; i < 32; ++i)
+			a[i] = BS_WORD(planes[i], w);
+		for(; i < 64; ++i)
+			a[i] = 0;
+		transpose64(a);
+		for(i = 0; i < 64; ++i)
+			x[w * 64 + i] = a[i];
+	}
+}
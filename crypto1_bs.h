@@ -0,0 +1,108 @@
+/*  crypto1_bs.h
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+*/
+#ifndef CRYPTO1_BS_INCLUDED
+#define CRYPTO1_BS_INCLUDED
+#include "crapto1.h"
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of independent Crypto1 states advanced in lock step.
+ * 64 uses plain integers, 128 and 256 use GCC vector extensions
+ * (SSE2 / AVX2 when the compiler is allowed to use them).
+ */
+#ifndef CRYPTO1_BS_BITS
+#define CRYPTO1_BS_BITS 64
+#endif
+#if CRYPTO1_BS_BITS == 64
+typedef uint64_t bitslice_t;
+#define BS_WORD(v, i) (v)
+#elif CRYPTO1_BS_BITS == 128 || CRYPTO1_BS_BITS == 256
+typedef uint64_t bitslice_t __attribute__((vector_size(CRYPTO1_BS_BITS / 8)));
+#define BS_WORD(v, i) ((v)[i])
+#else
+#error "CRYPTO1_BS_BITS must be 64, 128 or 256"
+#endif
+#define CRYPTO1_BS_LANES CRYPTO1_BS_BITS
+#define BS_ZERO ((bitslice_t){0})
+#define BS_ONES (~BS_ZERO)
+#define BS_LANE(v, l) (BS_WORD(v, (l) >> 6) >> ((l) & 63) & 1)
+
+/* planes of keystream history kept before sliding the window back */
+#define CRYPTO1_BS_WINDOW 256
+
+/* lfsr[t + i] holds bit i of the 48 bit register of every lane, oldest
+ * first, i.e. lfsr[t + 47 - 2k] is BIT(odd, k) and lfsr[t + 46 - 2k] is
+ * BIT(even, k) of the equivalent Crypto1State.
+ */
+struct Crypto1BS {
+	bitslice_t lfsr[48 + CRYPTO1_BS_WINDOW];
+	int t;
+};
+
+void crypto1_bs_init(struct Crypto1BS*);
+void crypto1_bs_set(struct Crypto1BS*, int, const struct Crypto1State*);
+void crypto1_bs_get(const struct Crypto1BS*, int, struct Crypto1State*);
+void crypto1_bs_set_key(struct Crypto1BS*, int, uint64_t);
+bitslice_t crypto1_bs_bit(struct Crypto1BS*, bitslice_t, int);
+void crypto1_bs_byte(struct Crypto1BS*, const bitslice_t*, int, bitslice_t*);
+void crypto1_bs_word(struct Crypto1BS*, const bitslice_t*, int, bitslice_t*);
+void crypto1_bs_keystream(struct Crypto1BS*, bitslice_t*, size_t);
+void crypto1_bs_set_keys(struct Crypto1BS*, const bitslice_t key[48]);
+bitslice_t crypto1_bs_auth_match(struct Crypto1BS*, uint32_t, uint32_t, uint32_t);
+
+void crypto1_bs_spread(bitslice_t planes[32], uint32_t);
+void crypto1_bs_pack(bitslice_t planes[32], const uint32_t*);
+void crypto1_bs_unpack(uint32_t*, const bitslice_t planes[32]);
+
+/* filter() expressed as gates, arguments are the nibble bits LSB first */
+#define FILTER_A_BS(b0, b1, b2, b3)\
+	((((b3) & (b2)) | (b1)) ^ (((b3) ^ (b2)) & ((b1) | (b0))))
+#define FILTER_B_BS(b0, b1, b2, b3)\
+	((((b3) | (b2)) ^ ((b3) & (b0))) ^ ((b1) & (((b3) ^ (b2)) | (b0))))
+#define FILTER_C_BS(f0, f1, f2, f3, f4)\
+	(((f0) | (((f1) | (f4)) & ((f3) ^ (f4)))) ^\
+	 (((f0) ^ ((f1) & (f3))) & (((f2) ^ (f3)) | ((f1) & (f4)))))
+
+/** filter_bs
+ * filter() of all lanes, p points at the oldest of the 48 register planes
+ */
+static inline bitslice_t filter_bs(const bitslice_t *p)
+{
+	return FILTER_C_BS(FILTER_B_BS(p[15], p[13], p[11], p[9]),
+			   FILTER_A_BS(p[23], p[21], p[19], p[17]),
+			   FILTER_A_BS(p[31], p[29], p[27], p[25]),
+			   FILTER_B_BS(p[39], p[37], p[35], p[33]),
+			   FILTER_A_BS(p[47], p[45], p[43], p[41]));
+}
+/** filter_bs_lsb
+ * filter() of all lanes, x[k] is the plane of bit k of its 20 bit input
+ */
+static inline bitslice_t filter_bs_lsb(const bitslice_t *x)
+{
+	return FILTER_C_BS(FILTER_B_BS(x[16], x[17], x[18], x[19]),
+			   FILTER_A_BS(x[12], x[13], x[14], x[15]),
+			   FILTER_A_BS(x[8], x[9], x[10], x[11]),
+			   FILTER_B_BS(x[4], x[5], x[6], x[7]),
+			   FILTER_A_BS(x[0], x[1], x[2], x[3]));
+}
+#ifdef __cplusplus
+}
+#endif
+#endif
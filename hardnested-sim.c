@@ -0,0 +1,129 @@
+/*  hardnested-sim.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+
+    Run the hardnested attack end to end against a simulated card with a
+    hardened nonce generator: knowing key A of sector 0, collect -N nonces
+    of one key of another sector, 2^15 by default, and recover it.  Nothing
+    of the key is given to the solver, the card's key is only used to check
+    the one found.  The exit status is 0 when that is the right one.
+
+      hardnested-sim [-N nonces] [-n sector] [-b] [-t threads] [-s seed]
+
+    Build:
+      cc -O2 -o hardnested-sim hardnested-sim.c hardnested.c nested.c \
+         mfsim.c crapto1.c crypto1.c crypto1_bs.c -lpthread
+*/
+#include "hardnested.h"
+#include "mfsim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+static int sim_auth(void *ctx, uint8_t block, int keyb, uint32_t *nt,
+		    uint8_t par[4])
+{
+	return mfsim_auth(ctx, block, keyb, nt, par);
+}
+static int sim_answer(void *ctx, uint32_t nr_enc, uint32_t ar_enc,
+		      uint32_t *at_enc)
+{
+	return mfsim_answer(ctx, nr_enc, ar_enc, at_enc);
+}
+static void sim_halt(void *ctx)
+{
+	mfsim_halt(ctx);
+}
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+static void progress(void *arg, const char *stage, double done)
+{
+	static const char *last;
+	int *pct = arg;
+
+	if(stage == last && (int)(done * 100) == *pct)
+		return;
+	if(last && stage != last)
+		fputc('\n', stderr);
+	last = stage;
+	*pct = done * 100;
+	fprintf(stderr, "\r%-8s %3d%%", stage, *pct);
+}
+
+int main(int argc, char *argv[])
+{
+	struct mfsim sim;
+	struct nested_card card = {0, sim_auth, sim_answer, sim_halt, &sim};
+	struct hardnested h = {0};
+	uint64_t seed = 1, key = 0;
+	int opt, pct = -1, sector = 1, keyb = 0, ret;
+	uint8_t block;
+	double t;
+
+	while((opt = getopt(argc, argv, "N:n:bt:s:")) != -1)
+		switch(opt) {
+		case 'N':
+			h.nonces = atoi(optarg);
+			break;
+		case 'n':
+			sector = atoi(optarg);
+			break;
+		case 'b':
+			keyb = 1;
+			break;
+		case 't':
+			h.threads = atoi(optarg);
+			break;
+		case 's':
+			seed = strtoull(optarg, 0, 0);
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-N nonces] [-n sector] [-b] "
+				"[-t threads] [-s seed]\n", argv[0]);
+			return 1;
+		}
+	if(sector < 1 || sector > 39)
+		sector = 1;
+	block = sector < 32 ? sector * 4 : 128 + (sector - 32) * 16;
+
+	mfsim_init(&sim, 0x4a7f13c2 ^ (uint32_t)seed, seed);
+	sim.hardened = 1;
+	card.uid = sim.uid;
+	h.progress = progress;
+	h.arg = &pct;
+
+	t = now();
+	ret = hardnested_recover(&card, 0, 0, sim.key[0][0], block, keyb, &h,
+				 &key);
+	t = now() - t;
+	fputc('\n', stderr);
+	printf("uid %08x, %zu nonces, sum %d\n", sim.uid, h.nsamples, h.sum);
+	if(ret)
+		printf("sector %2d key %c: not found\n", sector, "AB"[keyb]);
+	else
+		printf("sector %2d key %c: %012llx%s\n", sector, "AB"[keyb],
+		       (unsigned long long)key,
+		       key == sim.key[sector][keyb] ? "" : " WRONG");
+	printf("%.2fs, %.0f states tried\n", t, h.tried);
+	hardnested_free(&h);
+	return ret || key != sim.key[sector][keyb];
+}
@@ -0,0 +1,637 @@
+/*  hardnested.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+*/
+#include "hardnested.h"
+#include "crypto1_bs.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/* While the first byte of {nt} goes in, the reader side feeding uid ^ {nt}
+ * encrypted, the odd half O of the state gets the new bits m = n1 n3 n5 n7
+ * and makes keystream bits 0 2 4 6 8, the even half E gets e = n0 n2 n4 n6
+ * and makes 1 3 5 7.  The parity bit of the byte, xored with the parity of
+ * the encrypted byte, is 1 ^ X(O, m) ^ Y(E, e), X and Y being the parities
+ * of the keystream bits of each half.
+ *
+ * Each new bit is the feedback of one clock: the filter and the taps of the
+ * half in front, the taps of the other half and the bit fed in.  Sorting
+ * the terms by half, the 8 bits fed in are sig_odd(O, m) ^ sig_even(E, e).
+ * The filter sees the low 20 bits of a half only, its top 4 bits come in
+ * through the taps, linearly: sig_odd(O, m) is sig_odd(o, m) ^ lin[0][O >>
+ * 20] for the 20 bit part o, likewise for the even half.
+ *
+ * So with v[] the parity equations indexed by the bits fed in and s =
+ * sig_even(E, e) ^ the lin of both tops, X(o, m) ^ v[sig_odd(o, m) ^ s] is
+ * the same for all 16 m, namely 1 ^ Y(E, e).  Few s do that for a given o,
+ * about 16 for the right one, and most o have less than 16 of them.  The
+ * even bits of sig_even(x, e) ^ sig_even(x, 0) only depend on e, the odd
+ * bits and Y(x, e) tell even parts x apart: sorted by those for e = 0 .. 15
+ * they make a tree each odd part walks down along the s it allows.
+ *
+ * The second byte goes the same way from o << 4 | m and x << 4 | e: its
+ * parities, summed over all 256 second bytes, give p'q' + (16 - p')(16 - q')
+ * where p' = psum[0][o << 4 | m] and q' = psum[1][x << 4 | e].  Every s of
+ * an odd part meets 16 first bytes, one per m, so the ranges the nonces
+ * give for their sums bound the q' the walk may take there.  With 2^15
+ * nonces this leaves some 2^13 to 2^19 pairs of parts, each completed by
+ * the one pair of tops whose lin give s ^ sig_even(x, 0) and tried against
+ * the nonces with the bitsliced cipher.
+ *
+ * psum[0][x] is the number of the 16 new bits that make X(x, m) 1 and
+ * psum[1][x] the same for Y(x, e).
+ */
+static uint8_t psum[2][1 << 20];
+/* the even bits of sig_even(x, e) ^ sig_even(x, 0), the odd bits of a byte
+ * from a nibble, and the tops whose lin xor to each value
+ */
+static uint8_t ediff[16], odd_bits[16], top[256][2];
+static pthread_once_t psum_once = PTHREAD_ONCE_INIT;
+
+/** keystream_parity
+ * the parity of the 4 keystream bits the half x makes from its new bits
+ * a, n1 .. n7 or n0 .. n6 with the first of them the highest
+ */
+static int keystream_parity(uint32_t x, int a)
+{
+	int j, y = 0;
+
+	for(j = 1; j <= 4; ++j)
+		y ^= filter(x << j | a >> (4 - j));
+	return y;
+}
+/** sig_odd
+ * the odd half x's share of the bits fed in with the first byte, m its new
+ * bits
+ */
+static int sig_odd(uint32_t x, int m)
+{
+	uint32_t h;
+	int k, s = 0;
+
+	for(k = 0; k < 8; ++k) {
+		h = x << k / 2 | m >> (4 - k / 2);
+		if(k & 1)
+			s |= (BIT(m, 3 - k / 2) ^ parity(h & LF_POLY_EVEN)) << k;
+		else
+			s |= (filter(h) ^ parity(h & LF_POLY_ODD)) << k;
+	}
+	return s;
+}
+/** sig_even
+ * the even half x's share of the bits fed in with the first byte, e its new
+ * bits
+ */
+static int sig_even(uint32_t x, int e)
+{
+	uint32_t h;
+	int k, s = 0;
+
+	for(k = 0; k < 8; ++k) {
+		h = x << (k + 1) / 2 | e >> (4 - (k + 1) / 2);
+		if(k & 1)
+			s |= (filter(h) ^ parity(h & LF_POLY_ODD)) << k;
+		else
+			s |= (BIT(e, 3 - k / 2) ^ parity(h & LF_POLY_EVEN)) << k;
+	}
+	return s;
+}
+static void psum_init(void)
+{
+	uint32_t x, a, b, c, d, fa, fb, fc, y;
+	int lin[2][16], i, j;
+
+	for(x = 0; x < 1 << 20; ++x)
+		for(a = 0; a < 2; ++a) {
+			fa = filter(x << 1 | a);
+			for(b = 0; b < 2; ++b) {
+				fb = fa ^ filter(x << 2 | a << 1 | b);
+				for(c = 0; c < 2; ++c) {
+					fc = fb ^ filter(x << 3 | a << 2 | b << 1 | c);
+					for(d = 0; d < 2; ++d) {
+						y = fc ^ filter(x << 4 | a << 3 |
+								b << 2 | c << 1 | d);
+						psum[0][x] += filter(x) ^ y;
+						psum[1][x] += y;
+					}
+				}
+			}
+		}
+	for(i = 0; i < 16; ++i) {
+		ediff[i] = (sig_even(0, i) ^ sig_even(0, 0)) & 0x55;
+		for(odd_bits[i] = 0, j = 0; j < 4; ++j)
+			odd_bits[i] |= BIT(i, j) << (2 * j + 1);
+		lin[0][i] = sig_odd(i << 20, 0) ^ sig_odd(0, 0);
+		lin[1][i] = sig_even(i << 20, 0) ^ sig_even(0, 0);
+	}
+	for(i = 0; i < 16; ++i)
+		for(j = 0; j < 16; ++j) {
+			top[lin[0][i] ^ lin[1][j]][0] = i;
+			top[lin[0][i] ^ lin[1][j]][1] = j;
+		}
+}
+
+/** sample_match
+ * whether key explains the sample: its nt must agree with all 4 parities
+ */
+static int sample_match(uint64_t key, uint32_t uid,
+			const struct hardnested_sample *s)
+{
+	struct Crypto1State *c = crypto1_create(key);
+	uint32_t ks, nt;
+	int i, good = 1;
+
+	if(!c)
+		return 0;
+	ks = crypto1_word(c, s->nt_enc ^ uid, 1);
+	nt = s->nt_enc ^ ks;
+	for(i = 0; good && i < 3; ++i)
+		good = (s->par[i] ^ !parity(nt >> (24 - 8 * i) & 0xff)) ==
+			BEBIT(ks, 8 * i + 8);
+	good = good && (s->par[3] ^ !parity(nt & 0xff)) == filter(c->odd);
+	crypto1_destroy(c);
+	return good;
+}
+/** hardnested_collect
+ * add nested authentications to tblock, each started under the known key
+ * of block, to h->samples until there are h->nonces of them and every
+ * first byte of {nt} has been seen.  Returns 0 when done, 1 when twice that
+ * many still miss a first byte and -1 when the card failed or out of
+ * memory.
+ */
+int hardnested_collect(struct nested_card *c, uint8_t block, int keyb,
+		       uint64_t key, uint8_t tblock, int tkeyb,
+		       struct hardnested *h)
+{
+	struct hardnested_sample *s;
+	uint8_t seen[256] = {0};
+	size_t i, want = h->nonces > 0 ? h->nonces : 1 << 15;
+	uint32_t nt0;
+	int n = 0, ret = -1;
+
+	for(i = 0; i < h->nsamples; ++i)
+		n += !seen[h->samples[i].nt_enc >> 24]++;
+
+	while(n < 256 || h->nsamples < want) {
+		if(h->nsamples >= 2 * want) {
+			ret = 1;
+			goto out;
+		}
+		s = realloc(h->samples, sizeof(*s) * (h->nsamples + 1));
+		if(!s)
+			goto out;
+		h->samples = s;
+		s += h->nsamples;
+		if(nested_auth(c, block, keyb, key, &nt0) ||
+		   c->auth(c->ctx, tblock, tkeyb, &s->nt_enc, s->par))
+			goto out;
+		c->halt(c->ctx);
+		h->nsamples++;
+
+		n += !seen[s->nt_enc >> 24]++;
+		if(h->progress)
+			h->progress(h->arg, "collect", (double)h->nsamples / want);
+	}
+	ret = 0;
+out:
+	c->halt(c->ctx);
+	return ret;
+}
+
+/* an even part: the low 20 bits x of an even half and for each e the odd
+ * bits of sig_even(x, e) ^ sig_even(x, 0) as a nibble, Y(x, e) and q' / 2
+ * above it.  The odd parts are cut into tasks of TASK_ODD.
+ */
+#define TASK_ODD 1024
+struct even_part {
+	uint16_t d[16];
+	uint32_t x;
+};
+struct solve {
+	uint32_t uid;
+	/* the parity equations and the q' / 2 allowed for each p' / 2,
+	 * indexed by the bits fed in with the first byte
+	 */
+	uint8_t v[256];
+	uint16_t qok[256][9];
+	struct even_part *even;
+	const struct hardnested *h;
+	size_t next, done;
+	uint64_t tried;
+	int found;
+	uint64_t key;
+};
+/* one odd part on its walk, and the states it turned up not yet tried */
+struct walk {
+	struct solve *s;
+	struct Crypto1BS *bs;
+	uint32_t o;
+	int s0;
+	uint8_t sig[16], p[16], ok[256], y[256];
+	uint16_t q[256];
+	uint32_t odd[CRYPTO1_BS_LANES], even[CRYPTO1_BS_LANES];
+	int n;
+};
+
+/** bs_alloc
+ * malloc is not bound to align the wider bitslice_t, and aligned_alloc
+ * wants a multiple of the alignment
+ */
+static void *bs_alloc(size_t size)
+{
+	size_t align = _Alignof(bitslice_t);
+
+	return aligned_alloc(align, (size + align - 1) / align * align);
+}
+static int even_cmp(const void *a, const void *b)
+{
+	const struct even_part *x = a, *y = b;
+	int i;
+
+	for(i = 0; i < 16; ++i)
+		if(x->d[i] != y->d[i])
+			return x->d[i] - y->d[i];
+	return 0;
+}
+/** even_parts
+ * all 2^20 even parts sorted into the tree the odd parts walk
+ */
+static struct even_part *even_parts(void)
+{
+	struct even_part *even = malloc(sizeof(*even) << 20);
+	uint32_t x, d;
+	int e, n0, j;
+
+	if(!even)
+		return 0;
+	for(x = 0; x < 1 << 20; ++x) {
+		even[x].x = x;
+		n0 = sig_even(x, 0);
+		for(e = 0; e < 16; ++e) {
+			d = sig_even(x, e) ^ n0;
+			for(even[x].d[e] = 0, j = 0; j < 4; ++j)
+				even[x].d[e] |= BIT(d, 2 * j + 1) << j;
+			even[x].d[e] |= keystream_parity(x, e) << 4 |
+					psum[1][(x << 4 | e) & 0xfffff] / 2 << 5;
+		}
+	}
+	qsort(even, 1 << 20, sizeof(*even), even_cmp);
+	return even;
+}
+/** hit
+ * check a state that passed the bitsliced test against the whole nonces
+ */
+static void hit(struct solve *s, uint32_t odd, uint32_t even)
+{
+	struct Crypto1State st = {odd, even};
+	uint64_t key;
+	size_t i;
+
+	crypto1_get_lfsr(&st, &key);
+	for(i = 0; i < s->h->nsamples && i < 64; ++i)
+		if(!sample_match(key, s->uid, s->h->samples + i))
+			return;
+	s->key = key;
+	__atomic_store_n(&s->found, 1, __ATOMIC_RELEASE);
+}
+/** flush
+ * run the states the walk turned up, CRYPTO1_BS_LANES at a time, through
+ * the first nonces, giving up once none agrees with all 4 parities
+ */
+static void flush(struct walk *w)
+{
+	const struct hardnested_sample *n = w->s->h->samples;
+	struct Crypto1BS *bs = w->bs;
+	bitslice_t odd[32], even[32], in[32], ks[32], good = BS_ONES, x, any;
+	size_t i;
+	int j, k, l;
+
+	if(!w->n)
+		return;
+	for(l = w->n; l < CRYPTO1_BS_LANES; ++l) {
+		w->odd[l] = w->odd[w->n - 1];
+		w->even[l] = w->even[w->n - 1];
+	}
+	crypto1_bs_pack(odd, w->odd);
+	crypto1_bs_pack(even, w->even);
+
+	for(i = 0; i < w->s->h->nsamples && i < 8; ++i, ++n) {
+		for(k = 0; k < 24; ++k) {
+			bs->lfsr[47 - 2 * k] = odd[k];
+			bs->lfsr[46 - 2 * k] = even[k];
+		}
+		bs->t = 0;
+		crypto1_bs_spread(in, n->nt_enc ^ w->s->uid);
+		crypto1_bs_word(bs, in, 1, ks);
+		for(j = 0; j < 4; ++j) {
+			x = j < 3 ? ks[(8 * j + 8) ^ 24] :
+				    filter_bs(bs->lfsr + bs->t);
+			for(k = 0; k < 8; ++k)
+				x ^= ks[24 - 8 * j + k];
+			if(n->par[j] ^ !parity(n->nt_enc >> (24 - 8 * j) & 0xff))
+				x = ~x;
+			good &= ~x;
+		}
+		for(any = BS_ZERO, l = 0; l < CRYPTO1_BS_LANES / 64; ++l)
+			BS_WORD(any, 0) |= BS_WORD(good, l);
+		if(!BS_WORD(any, 0))
+			break;
+	}
+	for(l = 0; l < w->n; ++l)
+		if(BS_LANE(good, l))
+			hit(w->s, w->odd[l], w->even[l]);
+	__atomic_fetch_add(&w->s->tried, w->n, __ATOMIC_RELAXED);
+	w->n = 0;
+}
+/** lower
+ * the first even part from lo on whose digit e is at least d
+ */
+static size_t lower(const struct even_part *even, size_t lo, size_t hi,
+		    int e, int d)
+{
+	size_t mid;
+
+	while(lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if(even[mid].d[e] < d)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+/** walk
+ * the even parts in lo .. hi agree with the odd part for the new bits
+ * before e; follow those that do for e as well, one run of equal digits
+ * at a time.  At the end the top bits of both halves follow from s0.
+ */
+static void walk(struct walk *w, size_t lo, size_t hi, int e)
+{
+	const struct even_part *even = w->s->even;
+	size_t end;
+	int s, d, lam;
+
+	if(e == 16) {
+		for(; lo < hi; ++lo) {
+			lam = w->s0 ^ sig_even(even[lo].x, 0);
+			w->odd[w->n] = w->o | top[lam][0] << 20;
+			w->even[w->n] = even[lo].x | top[lam][1] << 20;
+			if(++w->n == CRYPTO1_BS_LANES)
+				flush(w);
+		}
+		return;
+	}
+	for(; lo < hi; lo = end) {
+		d = even[lo].d[e];
+		end = lower(even, lo + 1, hi, e, d + 1);
+		s = w->s0 ^ ediff[e] ^ odd_bits[d & 15];
+		if(w->ok[s] && w->y[s] == (d >> 4 & 1) && w->q[s] >> (d >> 5) & 1)
+			walk(w, lo, end, e + 1);
+	}
+}
+/** odd_part
+ * the s the parity equations allow for the odd part o, each with the Y
+ * and the q' it asks of the even part, and the walks starting from them
+ */
+static void odd_part(struct walk *w, uint32_t o)
+{
+	struct solve *s = w->s;
+	uint8_t x[16];
+	int m, n = 0, c;
+
+	w->o = o;
+	for(m = 0; m < 16; ++m) {
+		w->sig[m] = sig_odd(o, m);
+		x[m] = 1 ^ filter(o) ^ keystream_parity(o, m);
+		w->p[m] = psum[0][(o << 4 | m) & 0xfffff] / 2;
+	}
+	for(c = 0; c < 256; ++c) {
+		w->y[c] = x[0] ^ s->v[w->sig[0] ^ c];
+		for(m = 1; m < 16; ++m)
+			if((x[m] ^ s->v[w->sig[m] ^ c]) != w->y[c])
+				break;
+		if((w->ok[c] = m == 16)) {
+			for(w->q[c] = 0x1ff, m = 0; m < 16; ++m)
+				w->q[c] &= s->qok[w->sig[m] ^ c][w->p[m]];
+			n += !!w->q[c];
+		}
+	}
+	if(n < 16)
+		return;
+	for(w->s0 = 0; w->s0 < 256; ++w->s0)
+		if(w->ok[w->s0] && w->q[w->s0])
+			walk(w, 0, 1 << 20, 0);
+}
+/** search_task
+ * TASK_ODD odd parts against all even parts
+ */
+static void search_task(struct solve *s, struct walk *w, size_t task)
+{
+	uint32_t o, end = (task + 1) * TASK_ODD;
+
+	for(o = task * TASK_ODD;
+	    o < end && !__atomic_load_n(&s->found, __ATOMIC_ACQUIRE); ++o)
+		odd_part(w, o);
+	flush(w);
+}
+static void *search_work(void *arg)
+{
+	struct solve *s = arg;
+	struct walk *w = malloc(sizeof(*w));
+	size_t task;
+
+	if(!w || !(w->bs = bs_alloc(sizeof(*w->bs))))
+		goto out;
+	w->s = s;
+	w->n = 0;
+	crypto1_bs_init(w->bs);
+	while(!__atomic_load_n(&s->found, __ATOMIC_ACQUIRE) &&
+	      (task = __atomic_fetch_add(&s->next, 1, __ATOMIC_RELAXED)) <
+	      (1 << 20) / TASK_ODD) {
+		search_task(s, w, task);
+		__atomic_fetch_add(&s->done, 1, __ATOMIC_RELAXED);
+	}
+	free(w->bs);
+out:
+	free(w);
+	return 0;
+}
+/** search
+ * spread the tasks over threads, the calling thread reporting progress
+ * after each of its own
+ */
+static void search(struct solve *s, int threads)
+{
+	struct walk *w = malloc(sizeof(*w));
+	size_t task, ntasks = (1 << 20) / TASK_ODD;
+	pthread_t *tid;
+	int i, n = 1;
+
+	if(threads <= 0)
+		threads = sysconf(_SC_NPROCESSORS_ONLN);
+	if((tid = malloc(sizeof(*tid) * (threads > 1 ? threads : 1))))
+		for(; n < threads; ++n)
+			if(pthread_create(tid + n, 0, search_work, s))
+				break;
+
+	if(w && (w->bs = bs_alloc(sizeof(*w->bs)))) {
+		w->s = s;
+		w->n = 0;
+		crypto1_bs_init(w->bs);
+		while(!__atomic_load_n(&s->found, __ATOMIC_ACQUIRE) &&
+		      (task = __atomic_fetch_add(&s->next, 1,
+						 __ATOMIC_RELAXED)) < ntasks) {
+			search_task(s, w, task);
+			task = __atomic_add_fetch(&s->done, 1, __ATOMIC_RELAXED);
+			if(s->h->progress)
+				s->h->progress(s->h->arg, "search",
+					       (double)task / ntasks);
+		}
+		free(w->bs);
+	} else
+		search_work(s);
+	free(w);
+	for(i = 1; i < n; ++i)
+		pthread_join(tid[i], 0);
+	free(tid);
+}
+/** plausible
+ * whether k ones among d different second bytes are likely enough when
+ * sum of all 256 give a one: neither tail of the hypergeometric
+ * distribution may be below 1e-6
+ */
+static int plausible(int sum, int d, int k)
+{
+	double p = 1, lo = 0, hi = 0, all = 0;
+	int j = d + sum > 256 ? d + sum - 256 : 0, end = d < sum ? d : sum;
+
+	if(k < j || k > end)
+		return 0;
+	for(;; ++j) {
+		all += p;
+		lo += j <= k ? p : 0;
+		hi += j >= k ? p : 0;
+		if(j == end)
+			break;
+		p *= (double)(sum - j) * (d - j) / ((j + 1) * (256.0 - sum - d + j + 1));
+	}
+	return lo >= 1e-6 * all && hi >= 1e-6 * all;
+}
+/** equations
+ * the parity equation of every first byte of {nt} and the q' / 2 the
+ * second byte parities allow with each p' / 2, both by the bits fed in.
+ * Returns the sum of the first byte equations, -1 when a first byte is
+ * missing, the nonces contradict each other or out of memory.
+ */
+static int equations(struct solve *s)
+{
+	const struct hardnested *h = s->h;
+	uint8_t seen[256] = {0}, *second = calloc(1, 1 << 16);
+	int ones[256] = {0}, dist[256] = {0}, ok[257];
+	int i, b, p, q, v, sum = -1;
+	size_t n;
+
+	if(!second)
+		return -1;
+	for(n = 0; n < h->nsamples; ++n) {
+		i = (h->samples[n].nt_enc ^ s->uid) >> 24;
+		v = h->samples[n].par[0] ^ parity(h->samples[n].nt_enc >> 24);
+		if(seen[i]++ && s->v[i] != v)
+			goto out;
+		s->v[i] = v;
+
+		b = h->samples[n].nt_enc >> 16 & 0xff;
+		v = h->samples[n].par[1] ^ parity(b);
+		if(second[i << 8 | b] && second[i << 8 | b] != 1 + v)
+			goto out;
+		if(!second[i << 8 | b]) {
+			second[i << 8 | b] = 1 + v;
+			dist[i]++;
+			ones[i] += v;
+		}
+	}
+	for(sum = i = 0; i < 256; sum += s->v[i++])
+		if(!seen[i]) {
+			sum = -1;
+			goto out;
+		}
+	for(i = 0; i < 256; ++i) {
+		for(v = 0; v <= 256; v += 8)
+			ok[v] = plausible(v, dist[i], ones[i]);
+		for(p = 0; p < 9; ++p)
+			for(s->qok[i][p] = 0, q = 0; q < 9; ++q)
+				s->qok[i][p] |= ok[4 * p * q +
+						   4 * (8 - p) * (8 - q)] << q;
+	}
+out:
+	free(second);
+	return sum;
+}
+/** hardnested_solve
+ * the key behind h->samples.  Returns 0 with the key in found, 1 when no
+ * key explains the nonces and -1 when not every first byte of {nt} is among
+ * them, they contradict each other or out of memory.
+ */
+int hardnested_solve(uint32_t uid, struct hardnested *h, uint64_t *found)
+{
+	struct solve *s = calloc(1, sizeof(*s));
+	int ret = -1;
+
+	if(!s)
+		return -1;
+	s->uid = uid;
+	s->h = h;
+	pthread_once(&psum_once, psum_init);
+	if((h->sum = equations(s)) < 0 || !(s->even = even_parts()))
+		goto out;
+
+	search(s, h->threads);
+	h->tried = s->tried;
+	if(s->found)
+		*found = s->key;
+	ret = !s->found;
+out:
+	free(s->even);
+	free(s);
+	return ret;
+}
+/** hardnested_recover
+ * collect, solve and confirm the key of tblock with a plain authentication.
+ * Returns 0 when the key was found, see hardnested_solve otherwise.
+ */
+int hardnested_recover(struct nested_card *c, uint8_t block, int keyb,
+		       uint64_t key, uint8_t tblock, int tkeyb,
+		       struct hardnested *h, uint64_t *found)
+{
+	uint32_t nt;
+	int ret;
+
+	if((ret = hardnested_collect(c, block, keyb, key, tblock, tkeyb, h)))
+		return ret < 0 ? -1 : ret;
+	if((ret = hardnested_solve(c->uid, h, found)))
+		return ret;
+	ret = nested_auth(c, tblock, tkeyb, *found, &nt) ? 1 : 0;
+	c->halt(c->ctx);
+	return ret;
+}
+void hardnested_free(struct hardnested *h)
+{
+	free(h->samples);
+	h->samples = 0;
+	h->nsamples = 0;
+}
@@ -0,0 +1,71 @@
+/*  hardnested.h
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+*/
+#ifndef HARDNESTED_INCLUDED
+#define HARDNESTED_INCLUDED
+#include "nested.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Nested key recovery for cards whose nt can not be predicted.  Only the
+ * encrypted nonces and their parity bits are used: the parity bit of the
+ * first byte of {nt} gives one equation in the key for each of its 256
+ * values, the second byte parities summed over the nonces sharing a first
+ * byte tell something about the state after it.  Matched up half against
+ * half these leave a few hundred thousand states at most, which are tried
+ * with the bitsliced cipher.  2^15 nonces are enough for that.
+ */
+
+/* one nested authentication to the target, {nt} and its parity bits as
+ * received
+ */
+struct hardnested_sample {
+	uint32_t nt_enc;
+	uint8_t par[4];
+};
+struct hardnested {
+	/* 0 for one per online cpu */
+	int threads;
+	/* nonces to collect, 0 for 1 << 15 */
+	int nonces;
+	/* called from the calling thread, done runs from 0 to 1 per stage */
+	void (*progress)(void *arg, const char *stage, double done);
+	void *arg;
+
+	/* the nonces collected, or loaded by the caller before solving */
+	struct hardnested_sample *samples;
+	size_t nsamples;
+	/* what the solve saw: the sum of the first byte parities and the
+	 * number of states that were tried
+	 */
+	int sum;
+	double tried;
+};
+
+int hardnested_collect(struct nested_card*, uint8_t block, int keyb,
+		       uint64_t key, uint8_t tblock, int tkeyb,
+		       struct hardnested*);
+int hardnested_solve(uint32_t uid, struct hardnested*, uint64_t *found);
+int hardnested_recover(struct nested_card*, uint8_t block, int keyb,
+		       uint64_t key, uint8_t tblock, int tkeyb,
+		       struct hardnested*, uint64_t *found);
+void hardnested_free(struct hardnested*);
+#ifdef __cplusplus
+}
+#endif
+#endif
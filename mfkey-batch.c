@@ -0,0 +1,351 @@
+/*  mfkey-batch.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+
+    Recover sector keys from sniffed authentications, one per line, hex
+    except for the decimal sector and the key type A or B:
+
+      uid sector keytype nt {nr} {ar} {at}               (mfkey64)
+      uid sector keytype nt0 {nr0} {ar0} nt1 {nr1} {ar1} (mfkey32)
+
+    The mfkey32 form only needs the reader side of two authentications
+    and checks the key found from the first against the second.  Lines
+    for the same uid, sector and key type are solved once.  Keys are
+    written as "uid sector keytype key", unsolved ones with a key of -.
+
+    -s writes what each solve went through to standard error, with
+    crapto1.c built with -DCRAPTO1_STATS.
+
+    Build:
+      cc -O2 -o mfkey-batch mfkey-batch.c crapto1.c crypto1.c -lpthread
+*/
+#include "crapto1.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+struct trace {
+	uint32_t uid, sector, nt, nr, ar, at, nt1, nr1, ar1;
+	char type;
+	int is32;
+};
+/* traces of one uid / sector / key type, solved by the first that works */
+struct group {
+	struct trace *first;
+	size_t len;
+	uint64_t key;
+	int found;
+};
+struct batch {
+	struct group *groups;
+	size_t ngroups, next, solves;
+};
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int show_stats;
+
+/* candidate check of one trace, the key is left in key */
+struct check {
+	const struct trace *t;
+	uint64_t key;
+};
+/** replay
+ * run an authentication with key: 1 when it reproduces {ar} and, when at
+ * is not 0, {at} as well, 0 when it does not and -1 when out of memory
+ */
+static int replay(uint64_t key, uint32_t uid, uint32_t nt, uint32_t nr,
+		  uint32_t ar, const uint32_t *at)
+{
+	struct Crypto1State *v;
+	uint32_t ks2, ks3;
+
+	if(!(v = crypto1_create(key)))
+		return -1;
+	crypto1_word(v, uid ^ nt, 0);
+	crypto1_word(v, nr, 1);
+	ks2 = crypto1_word(v, 0, 0);
+	ks3 = crypto1_word(v, 0, 0);
+	crypto1_destroy(v);
+	return (ks2 ^ prng_successor(nt, 64)) == ar &&
+	       (!at || (ks3 ^ prng_successor(nt, 96)) == *at);
+}
+/** check64
+ * roll a state recovered at {ar} back to the key and replay the
+ * authentication with it, so a candidate not matching the whole trace is
+ * passed over
+ */
+static int check64(struct Crypto1State *s, void *arg)
+{
+	struct check *c = arg;
+	const struct trace *t = c->t;
+
+	lfsr_rollback_word(s, 0, 0);
+	lfsr_rollback_word(s, 0, 0);
+	lfsr_rollback_word(s, t->nr, 1);
+	lfsr_rollback_word(s, t->uid ^ t->nt, 0);
+	crypto1_get_lfsr(s, &c->key);
+	return replay(c->key, t->uid, t->nt, t->nr, t->ar, &t->at);
+}
+/** check32
+ * roll a state recovered at {ar} back to the key and replay the second
+ * authentication with it
+ */
+static int check32(struct Crypto1State *s, void *arg)
+{
+	struct check *c = arg;
+	const struct trace *t = c->t;
+
+	lfsr_rollback_word(s, 0, 0);
+	lfsr_rollback_word(s, t->nr, 1);
+	lfsr_rollback_word(s, t->uid ^ t->nt, 0);
+	crypto1_get_lfsr(s, &c->key);
+	return replay(c->key, t->uid, t->nt1, t->nr1, t->ar1, 0);
+}
+/** print_stats
+ * the counters of the solve of t, on one line to stderr: the entries left
+ * of each recovery32 half after 9 and 16 bits, the bucket pairs joined at
+ * each level and the candidates checked
+ */
+static void print_stats(const struct trace *t)
+{
+	struct crapto1_stats st;
+
+	crapto1_stats(&st, 1);
+	fprintf(stderr, "%08x %u %c: odd %llu %llu even %llu %llu joins "
+		"%llu %llu %llu candidates %llu\n", t->uid, t->sector, t->type,
+		(unsigned long long)st.survivors[1][8],
+		(unsigned long long)st.survivors[1][15],
+		(unsigned long long)st.survivors[0][8],
+		(unsigned long long)st.survivors[0][15],
+		(unsigned long long)st.joins[0], (unsigned long long)st.joins[1],
+		(unsigned long long)st.joins[2],
+		(unsigned long long)st.candidates);
+}
+/** solve
+ * the key of t, on the buffers of ws or, when it is 0, on ones allocated
+ * for the solve
+ */
+static int solve(struct crapto1_ws *ws, const struct trace *t, uint64_t *key)
+{
+	struct check c = {t, 0};
+	uint32_t ks2 = t->ar ^ prng_successor(t->nt, 64);
+	uint32_t ks3 = t->at ^ prng_successor(t->nt, 96);
+	int ret;
+
+	if(t->is32)
+		ret = ws ? lfsr_recovery32_cb_ws(ws, ks2, 0, check32, &c) :
+			   lfsr_recovery32_cb(ks2, 0, check32, &c);
+	else
+		ret = ws ? lfsr_recovery64_cb_ws(ws, ks2, ks3, check64, &c) :
+			   lfsr_recovery64_cb(ks2, ks3, check64, &c);
+	*key = c.key;
+	if(show_stats)
+		print_stats(t);
+	return ret == 1;
+}
+static void *work(void *arg)
+{
+	struct batch *b = arg;
+	struct crapto1_ws *ws = crapto1_ws_create(CRAPTO1_WS_HUGEPAGES);
+	struct group *g;
+	size_t i, j;
+
+	/* slower, but the groups are still solved */
+	if(!ws)
+		fprintf(stderr, "no workspace, solving without one\n");
+
+	while((i = __atomic_fetch_add(&b->next, 1, __ATOMIC_RELAXED))
+	      < b->ngroups) {
+		g = b->groups + i;
+		for(j = 0; !g->found && j < g->len; ++j) {
+			g->found = solve(ws, g->first + j, &g->key);
+			__atomic_fetch_add(&b->solves, 1, __ATOMIC_RELAXED);
+		}
+	}
+	crapto1_ws_destroy(ws);
+	return 0;
+}
+
+static int parse(const char *line, struct trace *t)
+{
+	int n;
+
+	memset(t, 0, sizeof(*t));
+	n = sscanf(line, "%x %u %c %x %x %x %x %x %x", &t->uid, &t->sector,
+		   &t->type, &t->nt, &t->nr, &t->ar, &t->nt1, &t->nr1, &t->ar1);
+	t->type &= ~0x20;
+	if(t->type != 'A' && t->type != 'B')
+		return -1;
+	if(n == 7)
+		t->at = t->nt1;
+	else if(n == 9)
+		t->is32 = 1;
+	else
+		return -1;
+	return 0;
+}
+static int read_traces(FILE *f, const char *name, struct trace **traces,
+		       size_t *len, size_t *size)
+{
+	struct trace *p;
+	char line[256];
+	size_t lineno = 0;
+	char *c;
+
+	while(fgets(line, sizeof(line), f)) {
+		++lineno;
+		for(c = line; *c == ' ' || *c == '\t'; ++c);
+		if(*c == '#' || *c == '\n' || !*c)
+			continue;
+		if(*len == *size) {
+			p = realloc(*traces, sizeof(*p) * (*size ? *size << 1 : 1024));
+			if(!p)
+				return -1;
+			*traces = p;
+			*size = *size ? *size << 1 : 1024;
+		}
+		if(parse(c, *traces + *len))
+			fprintf(stderr, "%s:%zu: skipping malformed line\n",
+				name, lineno);
+		else
+			++*len;
+	}
+	return 0;
+}
+static int trace_cmp(const void *a, const void *b)
+{
+	const struct trace *x = a, *y = b;
+
+	if(x->uid != y->uid)
+		return x->uid < y->uid ? -1 : 1;
+	if(x->sector != y->sector)
+		return x->sector < y->sector ? -1 : 1;
+	if(x->type != y->type)
+		return x->type - y->type;
+	/* prefer the cheaper and more certain mfkey64 traces */
+	return x->is32 - y->is32;
+}
+static int same_key(const struct trace *x, const struct trace *y)
+{
+	return x->uid == y->uid && x->sector == y->sector && x->type == y->type;
+}
+
+static void usage(const char *argv0)
+{
+	fprintf(stderr, "Usage: %s [-t threads] [-o keyfile] [-s] [trace ...]\n"
+		"Reads standard input when no trace file is given.\n", argv0);
+	exit(1);
+}
+int main(int argc, char *argv[])
+{
+	struct batch b = {0};
+	struct trace *traces = 0;
+	size_t i, len = 0, size = 0, found = 0;
+	pthread_t *threads;
+	FILE *f, *out = stdout;
+	int opt, n = 0, started;
+	double t;
+
+	while((opt = getopt(argc, argv, "t:o:sh")) != -1)
+		switch(opt) {
+		case 's':
+			show_stats = 1;
+			break;
+		case 't':
+			n = atoi(optarg);
+			break;
+		case 'o':
+			if(!(out = fopen(optarg, "w"))) {
+				perror(optarg);
+				return 1;
+			}
+			break;
+		default:
+			usage(argv[0]);
+		}
+	if(n <= 0)
+		n = sysconf(_SC_NPROCESSORS_ONLN);
+	if(n <= 0)
+		n = 1;
+
+	if(optind == argc && read_traces(stdin, "-", &traces, &len, &size))
+		goto oom;
+	for(i = optind; i < (size_t)argc; ++i) {
+		if(!(f = fopen(argv[i], "r"))) {
+			perror(argv[i]);
+			return 1;
+		}
+		if(read_traces(f, argv[i], &traces, &len, &size))
+			goto oom;
+		fclose(f);
+	}
+
+	qsort(traces, len, sizeof(*traces), trace_cmp);
+	if(!(b.groups = calloc(len + 1, sizeof(*b.groups))))
+		goto oom;
+	for(i = 0; i < len; ++i) {
+		if(!i || !same_key(traces + i - 1, traces + i))
+			b.groups[b.ngroups++].first = traces + i;
+		b.groups[b.ngroups - 1].len++;
+	}
+
+	if(!(threads = malloc(sizeof(*threads) * n)))
+		goto oom;
+	t = now();
+	for(started = 0; started < n; ++started)
+		if(pthread_create(threads + started, 0, work, &b))
+			break;
+	if(!started)
+		work(&b);
+	for(opt = 0; opt < started; ++opt)
+		pthread_join(threads[opt], 0);
+	t = now() - t;
+
+	for(i = 0; i < b.ngroups; ++i) {
+		struct group *g = b.groups + i;
+
+		fprintf(out, "%08x %u %c ", g->first->uid, g->first->sector,
+			g->first->type);
+		if(g->found)
+			fprintf(out, "%012llx\n", (unsigned long long)g->key);
+		else
+			fputs("-\n", out);
+		found += g->found;
+	}
+	fprintf(stderr, "%zu traces, %zu keys, %zu unsolved, %zu solves in "
+		"%.2fs, %.2f solves/s on %d threads\n", len, found,
+		b.ngroups - found, b.solves, t, b.solves / t, started ? started : 1);
+
+	free(threads);
+	free(b.groups);
+	free(traces);
+	if(out != stdout)
+		fclose(out);
+	return 0;
+oom:
+	fprintf(stderr, "out of memory\n");
+	return 1;
+}
@@ -0,0 +1,307 @@
+/*  mfkey-dict.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+
+    Try the keys of a dictionary against one recorded authentication,
+    offline, CRYPTO1_BS_LANES keys per bitsliced pass:
+
+      mfkey-dict [-t threads] dictionary uid nt {nr} {ar} [{at}]
+
+    The dictionary holds one key per line as 12 hex digits, blank lines
+    and lines starting with # are skipped, as is anything else that is
+    not a key.  It is mapped into memory and cut into blocks the threads
+    claim in turn.  Every key reproducing {ar}, and {at} when given, is
+    printed; the exit status is 0 when there was one.
+
+    Build:
+      cc -O2 -march=native -o mfkey-dict mfkey-dict.c crapto1.c \
+         crypto1.c crypto1_bs.c -lpthread
+*/
+#include "crapto1.h"
+#include "crypto1_bs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* bytes of the dictionary claimed at a time */
+#define BLOCK (1 << 20)
+
+struct dict {
+	const char *map;
+	size_t size, next;
+	uint32_t uid, nt, nr, ar, at, ks2;
+	int has_at;
+	uint64_t keys, bad, done;
+	pthread_mutex_t lock;
+	size_t nhits;
+};
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/** verify
+ * scalar check of a hit, against {at} as well when it was given
+ */
+static int verify(const struct dict *d, uint64_t key)
+{
+	struct Crypto1State *c = crypto1_create(key);
+	uint32_t ks2, ks3;
+
+	if(!c)
+		return 0;
+	crypto1_word(c, d->uid ^ d->nt, 0);
+	crypto1_word(c, d->nr, 1);
+	ks2 = crypto1_word(c, 0, 0);
+	ks3 = crypto1_word(c, 0, 0);
+	crypto1_destroy(c);
+	return ks2 == d->ks2 &&
+	       (!d->has_at || ks3 == (d->at ^ prng_successor(d->nt, 96)));
+}
+/** try_keys
+ * one bitsliced pass over n <= CRYPTO1_BS_LANES keys, the missing lanes
+ * repeat the first key
+ */
+static void try_keys(struct dict *d, struct Crypto1BS *bs, uint32_t *lo,
+		     uint32_t *hi, int n)
+{
+	bitslice_t key[64], match;
+	int l;
+
+	for(l = n; l < CRYPTO1_BS_LANES; ++l) {
+		lo[l] = lo[0];
+		hi[l] = hi[0];
+	}
+	crypto1_bs_pack(key, lo);
+	crypto1_bs_pack(key + 32, hi);
+	bs->t = 0;
+	crypto1_bs_set_keys(bs, key);
+	match = crypto1_bs_auth_match(bs, d->uid ^ d->nt, d->nr, d->ks2);
+	for(l = 0; l < n; ++l) {
+		uint64_t k = (uint64_t)hi[l] << 32 | lo[l];
+
+		if(!BS_LANE(match, l) || !verify(d, k))
+			continue;
+		pthread_mutex_lock(&d->lock);
+		printf("%012llx\n", (unsigned long long)k);
+		fflush(stdout);
+		d->nhits++;
+		pthread_mutex_unlock(&d->lock);
+	}
+}
+/* value of a hex digit, 16 for anything else: random keys mix digits and
+ * letters too evenly for the comparisons to be predicted
+ */
+static uint8_t hex[256];
+
+static void hex_init(void)
+{
+	int c;
+
+	memset(hex, 16, sizeof(hex));
+	for(c = 0; c < 10; ++c)
+		hex['0' + c] = c;
+	for(c = 0; c < 6; ++c)
+		hex['a' + c] = hex['A' + c] = 10 + c;
+}
+/** parse_key
+ * the key on the line starting at p, -1 when it holds none
+ */
+static int64_t parse_key(const char *p, const char *end)
+{
+	int64_t key = 0;
+	int i, bad = 0;
+
+	while(p < end && (*p == ' ' || *p == '\t'))
+		++p;
+	if(end - p < 12)
+		return -1;
+	for(i = 0; i < 12; ++i) {
+		bad |= hex[(uint8_t)p[i]];
+		key = key << 4 | (hex[(uint8_t)p[i]] & 15);
+	}
+	p += 12;
+	if(bad & 16)
+		return -1;
+	return p == end || *p == '\n' || *p == '\r' || *p == ' ' ||
+	       *p == '\t' ? key : -1;
+}
+/** try_block
+ * the lines starting in [start, end) of the dictionary
+ */
+static void try_block(struct dict *d, struct Crypto1BS *bs, size_t start,
+		      size_t end)
+{
+	const char *p = d->map + start, *stop = d->map + end;
+	const char *eof = d->map + d->size, *nl;
+	uint32_t lo[CRYPTO1_BS_LANES], hi[CRYPTO1_BS_LANES];
+	uint64_t keys = 0, bad = 0;
+	int64_t key;
+	int n = 0;
+
+	/* a line running into the block belongs to the one before */
+	if(start && p[-1] != '\n') {
+		if(!(p = memchr(p, '\n', eof - p)))
+			return;
+		++p;
+	}
+	for(; p < stop; p = nl + 1) {
+		if(!(nl = memchr(p, '\n', eof - p)))
+			nl = eof;
+		if(nl == p || *p == '#' || *p == '\r')
+			continue;
+		if((key = parse_key(p, nl)) < 0) {
+			++bad;
+			continue;
+		}
+		lo[n] = key;
+		hi[n] = key >> 32;
+		++keys;
+		if(++n == CRYPTO1_BS_LANES) {
+			try_keys(d, bs, lo, hi, n);
+			n = 0;
+		}
+	}
+	if(n)
+		try_keys(d, bs, lo, hi, n);
+	__atomic_fetch_add(&d->keys, keys, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&d->bad, bad, __ATOMIC_RELAXED);
+}
+static void *work(void *arg)
+{
+	struct dict *d = arg;
+	struct Crypto1BS *bs = aligned_alloc(_Alignof(bitslice_t), sizeof(*bs));
+	size_t b;
+
+	if(!bs) {
+		fprintf(stderr, "out of memory\n");
+		exit(2);
+	}
+	crypto1_bs_init(bs);
+	while((b = __atomic_fetch_add(&d->next, BLOCK, __ATOMIC_RELAXED)) <
+	      d->size) {
+		try_block(d, bs, b, b + BLOCK < d->size ? b + BLOCK : d->size);
+		__atomic_fetch_add(&d->done, 1, __ATOMIC_RELAXED);
+	}
+	free(bs);
+	return 0;
+}
+
+static void usage(const char *argv0)
+{
+	fprintf(stderr, "Usage: %s [-t threads] dictionary uid nt {nr} {ar} "
+		"[{at}]\n", argv0);
+	exit(2);
+}
+int main(int argc, char *argv[])
+{
+	struct dict d;
+	struct stat st;
+	pthread_t *threads;
+	size_t blocks;
+	uint64_t last_keys = 0, keys;
+	int opt, fd, i, n = 0, started;
+	double t0, t, tlast;
+
+	memset(&d, 0, sizeof(d));
+	hex_init();
+	while((opt = getopt(argc, argv, "t:h")) != -1)
+		switch(opt) {
+		case 't':
+			n = atoi(optarg);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	if(argc - optind != 5 && argc - optind != 6)
+		usage(argv[0]);
+	d.uid = strtoul(argv[optind + 1], 0, 16);
+	d.nt = strtoul(argv[optind + 2], 0, 16);
+	d.nr = strtoul(argv[optind + 3], 0, 16);
+	d.ar = strtoul(argv[optind + 4], 0, 16);
+	d.ks2 = d.ar ^ prng_successor(d.nt, 64);
+	if((d.has_at = argc - optind == 6))
+		d.at = strtoul(argv[optind + 5], 0, 16);
+	if(n <= 0)
+		n = sysconf(_SC_NPROCESSORS_ONLN);
+	if(n <= 0)
+		n = 1;
+
+	if((fd = open(argv[optind], O_RDONLY)) < 0 || fstat(fd, &st)) {
+		perror(argv[optind]);
+		return 2;
+	}
+	if(!(d.size = st.st_size)) {
+		fprintf(stderr, "%s: empty\n", argv[optind]);
+		return 1;
+	}
+	d.map = mmap(0, d.size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if(d.map == MAP_FAILED) {
+		perror(argv[optind]);
+		return 2;
+	}
+	close(fd);
+	madvise((void *)d.map, d.size, MADV_SEQUENTIAL);
+	pthread_mutex_init(&d.lock, 0);
+	blocks = (d.size + BLOCK - 1) / BLOCK;
+
+	if(!(threads = malloc(sizeof(*threads) * n))) {
+		fprintf(stderr, "out of memory\n");
+		return 2;
+	}
+	fprintf(stderr, "%zu bytes, %d lanes, %d threads\n", d.size,
+		CRYPTO1_BS_LANES, n);
+
+	t0 = tlast = now();
+	for(started = 0; started < n; ++started)
+		if(pthread_create(threads + started, 0, work, &d))
+			break;
+	if(!started)
+		work(&d);
+	while(__atomic_load_n(&d.done, __ATOMIC_RELAXED) < blocks) {
+		usleep(100000);
+		if((t = now()) - tlast < 1)
+			continue;
+		keys = __atomic_load_n(&d.keys, __ATOMIC_RELAXED);
+		fprintf(stderr, "\r%6.2f%% %12.0f keys/s",
+			100.0 * __atomic_load_n(&d.done, __ATOMIC_RELAXED) /
+			blocks, (keys - last_keys) / (t - tlast));
+		tlast = t;
+		last_keys = keys;
+	}
+	for(i = 0; i < started; ++i)
+		pthread_join(threads[i], 0);
+	t = now() - t0;
+	if(tlast > t0)
+		fputc('\n', stderr);
+	fprintf(stderr, "%llu keys in %.2fs, %.0f keys/s, %llu bad lines, "
+		"%zu hits\n", (unsigned long long)d.keys, t, d.keys / t,
+		(unsigned long long)d.bad, d.nhits);
+
+	munmap((void *)d.map, d.size);
+	free(threads);
+	return !d.nhits;
+}
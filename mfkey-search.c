@@ -0,0 +1,404 @@
+/*  mfkey-search.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+
+    Brute force the keys base | (any value of the bits in mask) against a
+    single authentication, CRYPTO1_BS_LANES keys per bitsliced pass:
+
+      mfkey-search [-t threads] [-k base] [-m mask] [-S shard/shards]
+                   [-c checkpoint] uid nt {nr} {ar} [{at}]
+
+    Without {at} every key reproducing 32 bits of {ar} is printed, about
+    one false hit per 2^32 keys tried.  With {at} hits are checked
+    against it as well.  The checkpoint file is rewritten every half
+    minute and on SIGINT / SIGTERM, and is read back on start, so an
+    interrupted search resumes where it left off.
+
+    Build:
+      cc -O2 -march=native -o mfkey-search mfkey-search.c crapto1.c \
+         crypto1.c crypto1_bs.c -lpthread
+*/
+#include "crapto1.h"
+#include "crypto1_bs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <signal.h>
+
+/* a pass tries one key per lane, a chunk is the unit of work claimed */
+#define CHUNK_PASSES (1 << 12)
+#ifndef CHECKPOINT_SECONDS
+#define CHECKPOINT_SECONDS 30
+#endif
+
+struct search {
+	uint64_t base, mask;
+	uint32_t uid, nt, nr, ar, at;
+	int has_at;
+	/* lane bits: the lowest free key bits, their planes are constant */
+	int lanebits, freebits[48], nfree;
+	bitslice_t lane[8];
+	/* passes [first, last) of this shard, chunks claimed from next */
+	uint64_t first, last, next;
+	uint64_t *busy;
+	int threads;
+	pthread_mutex_t lock;
+	FILE *out;
+	uint64_t *hits;
+	size_t nhits;
+};
+
+static volatile sig_atomic_t interrupted;
+
+static void interrupt(int sig)
+{
+	interrupted = sig;
+}
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/** key_of
+ * candidate number i of the key space
+ */
+static uint64_t key_of(const struct search *s, uint64_t i)
+{
+	uint64_t key = s->base;
+	int j;
+
+	for(j = 0; j < s->nfree; ++j)
+		key |= (i >> j & 1) << s->freebits[j];
+	return key;
+}
+/** verify
+ * scalar check of a hit, against {at} as well when it was given
+ */
+static int verify(const struct search *s, uint64_t key)
+{
+	struct Crypto1State *c = crypto1_create(key);
+	uint32_t ks2, ks3;
+
+	if(!c)
+		return 0;
+	crypto1_word(c, s->uid ^ s->nt, 0);
+	crypto1_word(c, s->nr, 1);
+	ks2 = crypto1_word(c, 0, 0);
+	ks3 = crypto1_word(c, 0, 0);
+	crypto1_destroy(c);
+	return ks2 == (s->ar ^ prng_successor(s->nt, 64)) &&
+	       (!s->has_at || ks3 == (s->at ^ prng_successor(s->nt, 96)));
+}
+static void hit(struct search *s, uint64_t key)
+{
+	uint64_t *p;
+
+	pthread_mutex_lock(&s->lock);
+	fprintf(s->out, "%012llx\n", (unsigned long long)key);
+	fflush(s->out);
+	if((p = realloc(s->hits, sizeof(*p) * (s->nhits + 1)))) {
+		s->hits = p;
+		s->hits[s->nhits++] = key;
+	}
+	pthread_mutex_unlock(&s->lock);
+}
+/** search_pass
+ * try the CRYPTO1_BS_LANES keys of pass number pass
+ */
+static void search_pass(struct search *s, struct Crypto1BS *bs, uint64_t pass)
+{
+	bitslice_t key[48], match;
+	uint32_t ks2 = s->ar ^ prng_successor(s->nt, 64);
+	int i, j, l;
+
+	for(i = 0; i < 48; ++i)
+		key[i] = BIT(s->base, i) ? BS_ONES : BS_ZERO;
+	for(j = 0; j < s->nfree; ++j)
+		if(j < s->lanebits)
+			key[s->freebits[j]] = s->lane[j];
+		else if(BIT(pass, j - s->lanebits))
+			key[s->freebits[j]] = BS_ONES;
+
+	crypto1_bs_set_keys(bs, key);
+	match = crypto1_bs_auth_match(bs, s->uid ^ s->nt, s->nr, ks2);
+	for(l = 0; l < 1 << s->lanebits; ++l)
+		if(BS_LANE(match, l)) {
+			uint64_t k = key_of(s, pass << s->lanebits | l);
+
+			if(verify(s, k))
+				hit(s, k);
+		}
+}
+static void *work(void *arg)
+{
+	struct search *s = arg;
+	/* aligned_alloc wants a multiple of the alignment, malloc is not
+	 * bound to align the wider bitslice_t at all
+	 */
+	size_t align = _Alignof(bitslice_t);
+	struct Crypto1BS *bs = aligned_alloc(align, (sizeof(*bs) + align - 1) /
+					     align * align);
+	uint64_t c, p, end, *busy;
+	int id;
+
+	pthread_mutex_lock(&s->lock);
+	for(id = 0; s->busy[id] != ~0ULL; ++id);
+	busy = s->busy + id;
+	*busy = s->next;
+	pthread_mutex_unlock(&s->lock);
+
+	if(!bs) {
+		fprintf(stderr, "out of memory\n");
+		exit(2);
+	}
+	crypto1_bs_init(bs);
+	for(;;) {
+		/* never let done_passes() see a claimed chunk as free */
+		__atomic_store_n(busy, __atomic_load_n(&s->next,
+			__ATOMIC_RELAXED), __ATOMIC_RELEASE);
+		c = __atomic_fetch_add(&s->next, CHUNK_PASSES, __ATOMIC_RELAXED);
+		if(c >= s->last)
+			break;
+		__atomic_store_n(busy, c, __ATOMIC_RELEASE);
+		end = c + CHUNK_PASSES < s->last ? c + CHUNK_PASSES : s->last;
+		for(p = c; p < end; ++p)
+			search_pass(s, bs, p);
+	}
+	__atomic_store_n(busy, s->last, __ATOMIC_RELEASE);
+	free(bs);
+	return 0;
+}
+/** done_passes
+ * every pass below the returned one has been tried: chunks are claimed in
+ * order, so that is the oldest chunk still in progress
+ */
+static uint64_t done_passes(struct search *s)
+{
+	uint64_t low = __atomic_load_n(&s->next, __ATOMIC_RELAXED), b;
+	int i;
+
+	if(low > s->last)
+		low = s->last;
+	for(i = 0; i < s->threads; ++i) {
+		b = __atomic_load_n(s->busy + i, __ATOMIC_ACQUIRE);
+		if(b < low)
+			low = b;
+	}
+	return low;
+}
+
+static int checkpoint_write(struct search *s, const char *name, uint64_t done)
+{
+	char tmp[4096];
+	FILE *f;
+	size_t i;
+
+	snprintf(tmp, sizeof(tmp), "%s.tmp", name);
+	if(!(f = fopen(tmp, "w")))
+		return -1;
+	fprintf(f, "base %012llx mask %012llx first %llu last %llu next %llu\n",
+		(unsigned long long)s->base, (unsigned long long)s->mask,
+		(unsigned long long)s->first, (unsigned long long)s->last,
+		(unsigned long long)done);
+	pthread_mutex_lock(&s->lock);
+	for(i = 0; i < s->nhits; ++i)
+		fprintf(f, "hit %012llx\n", (unsigned long long)s->hits[i]);
+	pthread_mutex_unlock(&s->lock);
+	if(fclose(f))
+		return -1;
+	return rename(tmp, name);
+}
+/** checkpoint_read
+ * Returns 1 when name holds a checkpoint of this search, 0 when there is
+ * none and -1 when it belongs to another one.
+ */
+static int checkpoint_read(struct search *s, const char *name)
+{
+	unsigned long long base, mask, first, last, next, key;
+	char line[128];
+	FILE *f;
+
+	if(!(f = fopen(name, "r")))
+		return 0;
+	if(!fgets(line, sizeof(line), f) ||
+	   sscanf(line, "base %llx mask %llx first %llu last %llu next %llu",
+		  &base, &mask, &first, &last, &next) != 5 ||
+	   base != s->base || mask != s->mask ||
+	   first != s->first || last != s->last) {
+		fclose(f);
+		return -1;
+	}
+	s->next = next;
+	while(fgets(line, sizeof(line), f))
+		if(sscanf(line, "hit %llx", &key) == 1)
+			hit(s, key);
+	fclose(f);
+	return 1;
+}
+
+static void usage(const char *argv0)
+{
+	fprintf(stderr, "Usage: %s [-t threads] [-k base] [-m mask] "
+		"[-S shard/shards] [-c checkpoint] uid nt {nr} {ar} [{at}]\n",
+		argv0);
+	exit(1);
+}
+int main(int argc, char *argv[])
+{
+	struct search s;
+	unsigned long long base = 0, mask = 0xffffffffffffULL;
+	uint64_t passes, start, done, last_done;
+	const char *ckpt = 0;
+	pthread_t *threads;
+	unsigned shard = 0, shards = 1;
+	int opt, i, j, n = 0, started;
+	double t0, t, tc, tlast;
+
+	memset(&s, 0, sizeof(s));
+	while((opt = getopt(argc, argv, "t:k:m:S:c:h")) != -1)
+		switch(opt) {
+		case 't':
+			n = atoi(optarg);
+			break;
+		case 'k':
+			base = strtoull(optarg, 0, 16);
+			break;
+		case 'm':
+			mask = strtoull(optarg, 0, 16);
+			break;
+		case 'S':
+			if(sscanf(optarg, "%u/%u", &shard, &shards) != 2 ||
+			   shard >= shards)
+				usage(argv[0]);
+			break;
+		case 'c':
+			ckpt = optarg;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	if(argc - optind != 4 && argc - optind != 5)
+		usage(argv[0]);
+	s.uid = strtoul(argv[optind], 0, 16);
+	s.nt = strtoul(argv[optind + 1], 0, 16);
+	s.nr = strtoul(argv[optind + 2], 0, 16);
+	s.ar = strtoul(argv[optind + 3], 0, 16);
+	if((s.has_at = argc - optind == 5))
+		s.at = strtoul(argv[optind + 4], 0, 16);
+	if(n <= 0)
+		n = sysconf(_SC_NPROCESSORS_ONLN);
+	if(n <= 0)
+		n = 1;
+
+	s.mask = mask & 0xffffffffffffULL;
+	s.base = base & ~s.mask & 0xffffffffffffULL;
+	for(i = 0; i < 48; ++i)
+		if(BIT(s.mask, i))
+			s.freebits[s.nfree++] = i;
+	for(s.lanebits = 0; 1 << s.lanebits < CRYPTO1_BS_LANES &&
+	    s.lanebits < s.nfree; ++s.lanebits);
+	for(j = 0; j < s.lanebits; ++j)
+		for(i = 0; i < CRYPTO1_BS_LANES; ++i)
+			if(BIT(i, j))
+				BS_WORD(s.lane[j], i >> 6) |= 1ULL << (i & 63);
+
+	passes = 1ULL << (s.nfree - s.lanebits);
+	s.first = passes / shards * shard + (shard < passes % shards ? shard :
+					      passes % shards);
+	s.last = s.first + passes / shards + (shard < passes % shards);
+	s.next = s.first;
+	s.out = stdout;
+	pthread_mutex_init(&s.lock, 0);
+
+	if(ckpt && checkpoint_read(&s, ckpt) < 0) {
+		fprintf(stderr, "%s: checkpoint of a different search\n", ckpt);
+		return 1;
+	}
+	start = s.next;
+
+	threads = malloc(sizeof(*threads) * n);
+	s.busy = malloc(sizeof(*s.busy) * n);
+	if(!threads || !s.busy) {
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+	for(i = 0; i < n; ++i)
+		s.busy[i] = ~0ULL;
+	s.threads = n;
+	fprintf(stderr, "%llu keys, passes %llu..%llu of %llu, %d lanes, "
+		"%d threads\n", 1ULL << s.nfree, (unsigned long long)start,
+		(unsigned long long)s.last, (unsigned long long)passes,
+		CRYPTO1_BS_LANES, n);
+
+	t0 = tc = tlast = now();
+	last_done = start;
+	for(started = 0; started < n; ++started)
+		if(pthread_create(threads + started, 0, work, &s))
+			break;
+	if(!started) {
+		s.threads = 1;
+		work(&s);
+	}
+	/* the busy slots of threads that never started stay at ~0 */
+	s.threads = started ? started : 1;
+	signal(SIGINT, interrupt);
+	signal(SIGTERM, interrupt);
+	while(done_passes(&s) < s.last) {
+		usleep(100000);
+		if(interrupted) {
+			if(ckpt && checkpoint_write(&s, ckpt, done_passes(&s)))
+				perror(ckpt);
+			fprintf(stderr, "\ninterrupted\n");
+			return 1;
+		}
+		if((t = now()) - tlast < 1)
+			continue;
+		done = done_passes(&s);
+		fprintf(stderr, "\r%6.2f%% %12.0f keys/s",
+			100.0 * (done - s.first) / (s.last - s.first ? s.last -
+						      s.first : 1),
+			(double)(done - last_done) * (1 << s.lanebits) /
+			(t - tlast));
+		tlast = t;
+		last_done = done;
+		if(ckpt && t - tc >= CHECKPOINT_SECONDS) {
+			if(checkpoint_write(&s, ckpt, done))
+				perror(ckpt);
+			tc = t;
+		}
+	}
+	for(i = 0; i < started; ++i)
+		pthread_join(threads[i], 0);
+	t = now() - t0;
+	if(ckpt && checkpoint_write(&s, ckpt, s.last))
+		perror(ckpt);
+	if(tlast > t0)
+		fputc('\n', stderr);
+	fprintf(stderr, "%llu keys in %.2fs, %.0f keys/s, %zu hits\n",
+		(unsigned long long)(s.last - start) << s.lanebits, t,
+		(double)(s.last - start) * (1 << s.lanebits) / t, s.nhits);
+
+	free(threads);
+	free(s.busy);
+	free(s.hits);
+	return 0;
+}
@@ -0,0 +1,632 @@
+/*  mfkey-shard.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+
+    Spread one long key search over processes and machines sharing a
+    spool directory:
+
+      mfkey-shard split spool job shards recovery64 ks2 ks3
+      mfkey-shard split spool job shards prefix pfx rr ks par0 .. par7
+      mfkey-shard split spool job shards keys base mask uid nt {nr} {ar}
+                  [{at}]
+      mfkey-shard work [-w] spool
+      mfkey-shard merge spool job
+      mfkey-shard requeue [-t seconds] spool
+
+    split writes one descriptor per shard, job.N.shard, a few lines of
+    "name value" naming the job, the shard, its kind and its inputs:
+    recovery64 cuts the outer candidate loop of lfsr_recovery64, prefix the
+    odd candidates of the lfsr_common_prefix odd x even product (ks is the
+    8 NACK keystream nibbles, par0 .. par7 the parity bits of each {nr} as
+    8 digits) and keys the passes over base | (any value of the bits in
+    mask) as mfkey-search tries them.
+
+    work claims a shard by renaming it to job.N.shard.host.pid, runs it and
+    renames its result file into place as job.N.result: the job and shard
+    lines again, a "state odd even" or "key" line per state or key found
+    and "done" with their count.  Without -w it stops once the spool is
+    empty, with it it waits for more.  An interrupted worker puts its shard
+    back.  Start as many workers as there are cpus, on as many hosts.
+
+    merge prints the results of all shards in shard order, the same states
+    in the same order the unsharded recovery gives, and exits 0 when every
+    shard is done, listing the ones that are not otherwise.
+
+    A worker that was killed outright, or whose host went down, leaves its
+    claim behind.  requeue renames back the claims of this host whose
+    worker is gone and, with -t, every claim made more than that many
+    seconds ago: pick it well above the longest shard, a shard taken from
+    a live worker is only done twice.
+
+    Build:
+      cc -O2 -march=native -o mfkey-shard mfkey-shard.c crapto1.c \
+         crypto1.c crypto1_bs.c -lpthread
+*/
+#include "crapto1.h"
+#include "crypto1_bs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <errno.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+enum kind { RECOVERY64, PREFIX, KEYS };
+static const char *kinds[] = {"recovery64", "prefix", "keys"};
+
+struct shard {
+	char job[256];
+	unsigned shard, shards;
+	enum kind kind;
+	uint32_t ks2, ks3;
+	uint32_t pfx, rr;
+	uint8_t ks[8], par[8][8];
+	uint64_t base, mask;
+	uint32_t uid, nt, nr, ar, at;
+	int has_at;
+};
+
+/* where a running shard writes what it finds */
+struct result {
+	FILE *f;
+	unsigned long n;
+};
+
+/* the shard being worked on, its claimed name and its result in the
+ * making, for interrupt to put back, empty between shards
+ */
+static char shard_path[4096], claimed_path[4096 + 128], tmp_path[4096 + 128];
+
+static void interrupt(int sig)
+{
+	(void)sig;
+	if(*tmp_path)
+		unlink(tmp_path);
+	if(*claimed_path)
+		rename(claimed_path, shard_path);
+	_exit(1);
+}
+static int nibble(char c)
+{
+	return c >= '0' && c <= '9' ? c - '0' : ((c | 0x20) - 'a' + 10) & 15;
+}
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/** shard_write
+ * the descriptor of shard i, written under a temporary name and renamed
+ * so no worker sees half of it
+ */
+static int shard_write(const char *spool, struct shard *s)
+{
+	char path[4096], tmp[4096];
+	FILE *f;
+	int i, j;
+
+	snprintf(path, sizeof(path), "%s/%s.%u.shard", spool, s->job, s->shard);
+	snprintf(tmp, sizeof(tmp), "%s/.%s.%u.tmp", spool, s->job, s->shard);
+	if(!(f = fopen(tmp, "w")))
+		return -1;
+	fprintf(f, "job %s\nshard %u %u\nkind %s\n", s->job, s->shard,
+		s->shards, kinds[s->kind]);
+	switch(s->kind) {
+	case RECOVERY64:
+		fprintf(f, "ks2 %08x\nks3 %08x\n", s->ks2, s->ks3);
+		break;
+	case PREFIX:
+		fprintf(f, "pfx %08x\nrr %08x\nks ", s->pfx, s->rr);
+		for(i = 0; i < 8; ++i)
+			fprintf(f, "%x", s->ks[i]);
+		for(i = 0; i < 8; ++i)
+			for(fprintf(f, "\npar%d ", i), j = 0; j < 8; ++j)
+				fputc('0' + s->par[i][j], f);
+		fputc('\n', f);
+		break;
+	case KEYS:
+		fprintf(f, "base %012llx\nmask %012llx\n"
+			"auth %08x %08x %08x %08x\n",
+			(unsigned long long)s->base,
+			(unsigned long long)s->mask, s->uid, s->nt, s->nr, s->ar);
+		if(s->has_at)
+			fprintf(f, "at %08x\n", s->at);
+		break;
+	}
+	if(fclose(f))
+		return -1;
+	return rename(tmp, path);
+}
+/** shard_read
+ * Returns 0 when path holds a whole descriptor.
+ */
+static int shard_read(const char *path, struct shard *s)
+{
+	char line[256], name[32], ks[16], par[16];
+	unsigned long long a, b;
+	unsigned have = 0;
+	FILE *f;
+	int i, j;
+
+	memset(s, 0, sizeof(*s));
+	if(!(f = fopen(path, "r")))
+		return -1;
+	while(fgets(line, sizeof(line), f)) {
+		if(sscanf(line, "job %255s", s->job) == 1)
+			have |= 1;
+		else if(sscanf(line, "shard %u %u", &s->shard, &s->shards) == 2)
+			have |= 2;
+		else if(sscanf(line, "kind %31s", name) == 1) {
+			for(i = 0; i < 3 && strcmp(name, kinds[i]); ++i);
+			s->kind = i;
+			have |= i < 3 ? 4 : 0;
+		} else if(sscanf(line, "ks2 %x", &s->ks2) == 1)
+			have |= 8;
+		else if(sscanf(line, "ks3 %x", &s->ks3) == 1)
+			have |= 16;
+		else if(sscanf(line, "pfx %x", &s->pfx) == 1)
+			have |= 8;
+		else if(sscanf(line, "rr %x", &s->rr) == 1)
+			have |= 16;
+		else if(sscanf(line, "ks %8s", ks) == 1 && strlen(ks) == 8) {
+			for(i = 0; i < 8; ++i)
+				s->ks[i] = nibble(ks[i]);
+			have |= 32;
+		} else if(sscanf(line, "par%d %8s", &i, par) == 2 &&
+			  i >= 0 && i < 8 && strlen(par) == 8) {
+			for(j = 0; j < 8; ++j)
+				s->par[i][j] = par[j] == '1';
+			have |= 64 << i;
+		} else if(sscanf(line, "base %llx", &a) == 1) {
+			s->base = a;
+			have |= 8;
+		} else if(sscanf(line, "mask %llx", &b) == 1) {
+			s->mask = b & 0xffffffffffffULL;
+			have |= 16;
+		} else if(sscanf(line, "auth %x %x %x %x", &s->uid, &s->nt,
+				  &s->nr, &s->ar) == 4)
+			have |= 32;
+		else if(sscanf(line, "at %x", &s->at) == 1)
+			s->has_at = 1;
+	}
+	fclose(f);
+	if((have & 7) != 7 || s->shard >= s->shards)
+		return -1;
+	switch(s->kind) {
+	case RECOVERY64:
+		return (have & 24) == 24 ? 0 : -1;
+	case PREFIX:
+		return (have & 0x3ff8) == 0x3ff8 ? 0 : -1;
+	case KEYS:
+		return (have & 56) == 56 ? 0 : -1;
+	}
+	return -1;
+}
+
+static int found_state(struct Crypto1State *s, void *arg)
+{
+	struct result *r = arg;
+
+	fprintf(r->f, "state %06x %06x\n", s->odd, s->even);
+	r->n++;
+	return 0;
+}
+/** verify
+ * scalar check of a key range hit, against {at} as well when it was given
+ */
+static int verify(const struct shard *s, uint64_t key)
+{
+	struct Crypto1State *c = crypto1_create(key);
+	uint32_t ks2, ks3;
+
+	if(!c)
+		return 0;
+	crypto1_word(c, s->uid ^ s->nt, 0);
+	crypto1_word(c, s->nr, 1);
+	ks2 = crypto1_word(c, 0, 0);
+	ks3 = crypto1_word(c, 0, 0);
+	crypto1_destroy(c);
+	return ks2 == (s->ar ^ prng_successor(s->nt, 64)) &&
+	       (!s->has_at || ks3 == (s->at ^ prng_successor(s->nt, 96)));
+}
+/** run_keys
+ * the passes of this shard, the lowest free key bits spread over the
+ * lanes, the others counting up with the pass as in mfkey-search
+ */
+static int run_keys(const struct shard *s, struct result *r)
+{
+	struct Crypto1BS *bs = aligned_alloc(_Alignof(bitslice_t), sizeof(*bs));
+	bitslice_t key[48], base[48], match;
+	uint32_t ks2 = s->ar ^ prng_successor(s->nt, 64);
+	uint64_t passes, pass, last, idx, k;
+	int freebits[48], nfree = 0, lanebits, i, j, l;
+
+	if(!bs)
+		return -1;
+	for(i = 0; i < 48; ++i)
+		if(BIT(s->mask, i))
+			freebits[nfree++] = i;
+	for(lanebits = 0; 1 << lanebits < CRYPTO1_BS_LANES && lanebits < nfree;
+	    ++lanebits);
+	for(i = 0; i < 48; ++i)
+		base[i] = BIT(s->base & ~s->mask, i) ? BS_ONES : BS_ZERO;
+	for(j = 0; j < lanebits; ++j)
+		for(base[freebits[j]] = BS_ZERO, l = 0; l < CRYPTO1_BS_LANES; ++l)
+			if(BIT(l, j))
+				BS_WORD(base[freebits[j]], l >> 6) |= 1ULL << (l & 63);
+
+	passes = 1ULL << (nfree - lanebits);
+	pass = passes / s->shards * s->shard +
+	       (s->shard < passes % s->shards ? s->shard : passes % s->shards);
+	last = pass + passes / s->shards + (s->shard < passes % s->shards);
+
+	crypto1_bs_init(bs);
+	for(; pass < last; ++pass) {
+		memcpy(key, base, sizeof(key));
+		for(j = lanebits; j < nfree; ++j)
+			if(BIT(pass, j - lanebits))
+				key[freebits[j]] = BS_ONES;
+		bs->t = 0;
+		crypto1_bs_set_keys(bs, key);
+		match = crypto1_bs_auth_match(bs, s->uid ^ s->nt, s->nr, ks2);
+		for(l = 0; l < 1 << lanebits; ++l) {
+			if(!BS_LANE(match, l))
+				continue;
+			idx = pass << lanebits | l;
+			for(k = s->base & ~s->mask, j = 0; j < nfree; ++j)
+				k |= (idx >> j & 1) << freebits[j];
+			if(!verify(s, k))
+				continue;
+			fprintf(r->f, "key %012llx\n", (unsigned long long)k);
+			r->n++;
+		}
+	}
+	free(bs);
+	return 0;
+}
+/** run
+ * one shard into its result file
+ */
+static int run(const struct shard *s, struct result *r)
+{
+	uint8_t ks[8], par[8][8];
+
+	switch(s->kind) {
+	case RECOVERY64:
+		return lfsr_recovery64_shard(s->ks2, s->ks3, s->shard,
+					     s->shards, found_state, r);
+	case PREFIX:
+		memcpy(ks, s->ks, sizeof(ks));
+		memcpy(par, s->par, sizeof(par));
+		return lfsr_common_prefix_shard(s->pfx, s->rr, ks, par,
+						s->shard, s->shards,
+						found_state, r);
+	case KEYS:
+		return run_keys(s, r);
+	}
+	return -1;
+}
+
+/** claim
+ * rename the first shard left in the spool to its claimed name.  Returns 1
+ * when one was claimed, 0 when there are none left and -1 on error.
+ */
+static int claim(const char *spool)
+{
+	char host[64] = "localhost";
+	struct dirent *e;
+	size_t len;
+	DIR *d;
+	int ret = 0;
+
+	gethostname(host, sizeof(host) - 1);
+	if(!(d = opendir(spool)))
+		return -1;
+	while(!ret && (e = readdir(d))) {
+		len = strlen(e->d_name);
+		if(len < 7 || strcmp(e->d_name + len - 6, ".shard") ||
+		   e->d_name[0] == '.')
+			continue;
+		snprintf(shard_path, sizeof(shard_path), "%s/%s", spool,
+			 e->d_name);
+		snprintf(claimed_path, sizeof(claimed_path), "%s.%s.%d",
+			 shard_path, host, (int)getpid());
+		/* whoever renames it first has it, the others look on.  The
+		 * claim is dated for requeue -t
+		 */
+		if(!rename(shard_path, claimed_path)) {
+			utimensat(AT_FDCWD, claimed_path, 0, 0);
+			ret = 1;
+		} else if(errno != ENOENT)
+			ret = -1;
+	}
+	closedir(d);
+	return ret;
+}
+static int work(const char *spool, int wait)
+{
+	char path[4096 + 128];
+	sigset_t block, old;
+	struct result r;
+	struct shard s;
+	double t;
+	int c;
+
+	signal(SIGINT, interrupt);
+	signal(SIGTERM, interrupt);
+	sigemptyset(&block);
+	sigaddset(&block, SIGINT);
+	sigaddset(&block, SIGTERM);
+	for(;;) {
+		if((c = claim(spool)) < 0) {
+			perror(spool);
+			return 1;
+		}
+		if(!c) {
+			if(!wait)
+				return 0;
+			sleep(1);
+			continue;
+		}
+		if(shard_read(claimed_path, &s)) {
+			fprintf(stderr, "%s: not a shard\n", claimed_path);
+			continue;
+		}
+		snprintf(path, sizeof(path), "%s/%s.%u.result", spool, s.job,
+			 s.shard);
+		snprintf(tmp_path, sizeof(tmp_path), "%s/.%s.%u.result.%d",
+			 spool, s.job, s.shard, (int)getpid());
+		if(!(r.f = fopen(tmp_path, "w"))) {
+			perror(tmp_path);
+			rename(claimed_path, shard_path);
+			return 1;
+		}
+		r.n = 0;
+		fprintf(r.f, "job %s\nshard %u %u\n", s.job, s.shard, s.shards);
+
+		t = now();
+		if(run(&s, &r)) {
+			fclose(r.f);
+			unlink(tmp_path);
+			rename(claimed_path, shard_path);
+			fprintf(stderr, "%s: failed\n", shard_path);
+			return 1;
+		}
+		fprintf(r.f, "done %lu\n", r.n);
+		/* once the result is in place the shard must not go back */
+		sigprocmask(SIG_BLOCK, &block, &old);
+		if(fclose(r.f) || rename(tmp_path, path)) {
+			perror(path);
+			rename(claimed_path, shard_path);
+			return 1;
+		}
+		unlink(claimed_path);
+		*claimed_path = *tmp_path = 0;
+		sigprocmask(SIG_SETMASK, &old, 0);
+		fprintf(stderr, "%s %u/%u: %lu found in %.2fs\n", s.job, s.shard,
+			s.shards, r.n, now() - t);
+	}
+}
+
+/** merge
+ * the results of all shards of job in order, and the ones still missing
+ */
+static int merge(const char *spool, const char *job)
+{
+	char path[4096], line[256], name[256];
+	unsigned i, n = 0, sh, missing = 0;
+	unsigned long total = 0, count;
+	struct dirent *e;
+	size_t len = strlen(job);
+	FILE *f;
+	DIR *d;
+	int done;
+
+	if(!(d = opendir(spool))) {
+		perror(spool);
+		return 1;
+	}
+	/* the shard count from any file the job left */
+	while(!n && (e = readdir(d))) {
+		if(strncmp(e->d_name, job, len) || e->d_name[len] != '.')
+			continue;
+		snprintf(path, sizeof(path), "%s/%s", spool, e->d_name);
+		if(!(f = fopen(path, "r")))
+			continue;
+		while(fgets(line, sizeof(line), f))
+			if(sscanf(line, "job %255s", name) == 1 &&
+			   strcmp(name, job))
+				break;
+			else if(sscanf(line, "shard %u %u", &sh, &n) == 2)
+				break;
+		fclose(f);
+	}
+	closedir(d);
+	if(!n) {
+		fprintf(stderr, "%s: no shards of %s\n", spool, job);
+		return 1;
+	}
+
+	for(i = 0; i < n; ++i) {
+		snprintf(path, sizeof(path), "%s/%s.%u.result", spool, job, i);
+		done = 0;
+		if((f = fopen(path, "r"))) {
+			while(fgets(line, sizeof(line), f))
+				if(!strncmp(line, "state ", 6) ||
+				   !strncmp(line, "key ", 4))
+					fputs(line, stdout);
+				else if(sscanf(line, "done %lu", &count) == 1)
+					done = 1;
+			fclose(f);
+		}
+		if(done) {
+			total += count;
+			continue;
+		}
+		++missing;
+		snprintf(path, sizeof(path), "%s/%s.%u.shard", spool, job, i);
+		fprintf(stderr, "shard %u/%u: %s\n", i, n,
+			access(path, F_OK) ? "claimed, see requeue" : "queued");
+	}
+	fprintf(stderr, "%s: %u/%u shards done, %lu found\n", job, n - missing,
+		n, total);
+	return missing ? 1 : 0;
+}
+
+/** requeue
+ * rename back the claims in spool whose worker is known to be gone, or
+ * that are older than timeout seconds when it is not 0
+ */
+static int requeue(const char *spool, long timeout)
+{
+	char host[64] = "localhost", path[4096], back[4096], *p, *pid;
+	struct dirent *e;
+	struct stat st;
+	unsigned n = 0;
+	int stale;
+	DIR *d;
+
+	gethostname(host, sizeof(host) - 1);
+	if(!(d = opendir(spool))) {
+		perror(spool);
+		return 1;
+	}
+	while((e = readdir(d))) {
+		/* job.N.shard.host.pid, the host may hold dots of its own */
+		if(e->d_name[0] == '.' || !(p = strstr(e->d_name, ".shard.")) ||
+		   !(pid = strrchr(p + 7, '.')) || pid == p + 6)
+			continue;
+		snprintf(path, sizeof(path), "%s/%s", spool, e->d_name);
+		snprintf(back, sizeof(back), "%s/%.*s", spool,
+			 (int)(p + 6 - e->d_name), e->d_name);
+		stale = (size_t)(pid - p - 7) == strlen(host) &&
+			!strncmp(p + 7, host, pid - p - 7) &&
+			kill(atoi(pid + 1), 0) && errno == ESRCH;
+		if(!stale && timeout > 0 && !stat(path, &st))
+			stale = time(0) - st.st_mtime > timeout;
+		if(!stale)
+			continue;
+		if(!rename(path, back)) {
+			fprintf(stderr, "%s: requeued\n", e->d_name);
+			++n;
+		} else if(errno != ENOENT)
+			perror(path);
+	}
+	closedir(d);
+	fprintf(stderr, "%s: %u claims requeued\n", spool, n);
+	return 0;
+}
+
+static void usage(const char *argv0)
+{
+	fprintf(stderr, "Usage: %s split spool job shards recovery64 ks2 ks3\n"
+		"       %s split spool job shards prefix pfx rr ks par0 .. par7\n"
+		"       %s split spool job shards keys base mask uid nt {nr} {ar}"
+		" [{at}]\n"
+		"       %s work [-w] spool\n"
+		"       %s merge spool job\n"
+		"       %s requeue [-t seconds] spool\n",
+		argv0, argv0, argv0, argv0, argv0, argv0);
+	exit(2);
+}
+static int split(int argc, char *argv[])
+{
+	struct shard s;
+	const char *spool = argv[2], *kind = argv[5];
+	char **a = argv + 6;
+	int i, j, n, na = argc - 6;
+
+	memset(&s, 0, sizeof(s));
+	if(argc < 6 || strlen(argv[3]) >= sizeof(s.job) ||
+	   strchr(argv[3], '/') || (n = atoi(argv[4])) <= 0)
+		usage(argv[0]);
+	strcpy(s.job, argv[3]);
+	if(!strcmp(kind, "recovery64") && na == 2) {
+		s.kind = RECOVERY64;
+		s.ks2 = strtoul(a[0], 0, 16);
+		s.ks3 = strtoul(a[1], 0, 16);
+	} else if(!strcmp(kind, "prefix") && na == 11 && strlen(a[2]) == 8) {
+		s.kind = PREFIX;
+		s.pfx = strtoul(a[0], 0, 16);
+		s.rr = strtoul(a[1], 0, 16);
+		for(i = 0; i < 8; ++i)
+			s.ks[i] = nibble(a[2][i]);
+		for(i = 0; i < 8; ++i)
+			for(j = 0; j < 8 && a[3 + i][j]; ++j)
+				s.par[i][j] = a[3 + i][j] == '1';
+	} else if(!strcmp(kind, "keys") && (na == 6 || na == 7)) {
+		s.kind = KEYS;
+		s.mask = strtoull(a[1], 0, 16) & 0xffffffffffffULL;
+		s.base = strtoull(a[0], 0, 16) & ~s.mask & 0xffffffffffffULL;
+		s.uid = strtoul(a[2], 0, 16);
+		s.nt = strtoul(a[3], 0, 16);
+		s.nr = strtoul(a[4], 0, 16);
+		s.ar = strtoul(a[5], 0, 16);
+		if((s.has_at = na == 7))
+			s.at = strtoul(a[6], 0, 16);
+	} else
+		usage(argv[0]);
+
+	for(s.shards = n, s.shard = 0; s.shard < s.shards; ++s.shard)
+		if(shard_write(spool, &s)) {
+			perror(spool);
+			return 1;
+		}
+	fprintf(stderr, "%s: %d %s shards in %s\n", s.job, n, kinds[s.kind],
+		spool);
+	return 0;
+}
+int main(int argc, char *argv[])
+{
+	long timeout = 0;
+	int opt, wait = 0;
+
+	if(argc >= 6 && !strcmp(argv[1], "split"))
+		return split(argc, argv);
+	if(argc == 4 && !strcmp(argv[1], "merge"))
+		return merge(argv[2], argv[3]);
+	if(argc >= 3 && !strcmp(argv[1], "work")) {
+		optind = 2;
+		while((opt = getopt(argc, argv, "w")) != -1)
+			if(opt == 'w')
+				wait = 1;
+			else
+				usage(argv[0]);
+		if(argc - optind != 1)
+			usage(argv[0]);
+		return work(argv[optind], wait);
+	}
+	if(argc >= 3 && !strcmp(argv[1], "requeue")) {
+		optind = 2;
+		while((opt = getopt(argc, argv, "t:")) != -1)
+			if(opt == 't')
+				timeout = atol(optarg);
+			else
+				usage(argv[0]);
+		if(argc - optind != 1)
+			usage(argv[0]);
+		return requeue(argv[optind], timeout);
+	}
+	usage(argv[0]);
+	return 2;
+}
@@ -0,0 +1,105 @@
+/*  mfsim.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+*/
+#include "mfsim.h"
+#include <string.h>
+
+static uint32_t mfsim_rand(struct mfsim *c)
+{
+	c->rng ^= c->rng << 13;
+	c->rng ^= c->rng >> 7;
+	c->rng ^= c->rng << 17;
+	return c->rng >> 16;
+}
+static void mfsim_key(struct Crypto1State *s, uint64_t key)
+{
+	struct Crypto1State *t = crypto1_create(key);
+
+	*s = *t;
+	crypto1_destroy(t);
+}
+/** mfsim_init
+ * a card with random keys, the caller may overwrite them
+ */
+void mfsim_init(struct mfsim *c, uint32_t uid, uint64_t seed)
+{
+	int i;
+
+	memset(c, 0, sizeof(*c));
+	c->uid = uid;
+	c->rng = seed | 1;
+	for(i = 0; i < 80; ++i)
+		c->key[i >> 1][i & 1] = ((uint64_t)mfsim_rand(c) << 24 ^
+					 mfsim_rand(c)) & 0xffffffffffffULL;
+	c->nt = prng_jump(0x01200145, mfsim_rand(c) & 0xffff);
+	c->delay = 160;
+	c->jitter = 16;
+}
+/** mfsim_auth
+ * the card side of the first half of an authentication, nt is sent
+ * encrypted when an earlier authentication is still active (nested)
+ */
+int mfsim_auth(struct mfsim *c, uint8_t block, int keyb, uint32_t *nt,
+	       uint8_t par[4])
+{
+	uint32_t ks;
+	int i;
+
+	if(c->hardened)
+		c->nt = mfsim_rand(c);
+	else
+		c->nt = prng_jump(c->nt, c->delay +
+				       mfsim_rand(c) % (c->jitter + 1));
+	mfsim_key(&c->cs, c->key[MFSIM_SECTOR(block)][!!keyb]);
+
+	ks = crypto1_word(&c->cs, c->uid ^ c->nt, 0);
+	for(i = 0; i < 4; ++i)
+		par[i] = !parity(c->nt >> (24 - 8 * i) & 0xff);
+	if(c->authed) {
+		*nt = c->nt ^ ks;
+		for(i = 0; i < 3; ++i)
+			par[i] ^= BEBIT(ks, 8 * i + 8);
+		par[3] ^= filter(c->cs.odd);
+	} else
+		*nt = c->nt;
+
+	c->authed = 0;
+	c->pending = 1;
+	return 0;
+}
+/** mfsim_answer
+ * check the reader's {nr} {ar}, on success the card is authenticated
+ */
+int mfsim_answer(struct mfsim *c, uint32_t nr_enc, uint32_t ar_enc,
+		 uint32_t *at_enc)
+{
+	if(!c->pending)
+		return -1;
+	c->pending = 0;
+
+	crypto1_word(&c->cs, nr_enc, 1);
+	if((ar_enc ^ crypto1_word(&c->cs, 0, 0)) != prng_successor(c->nt, 64))
+		return -1;
+
+	*at_enc = prng_successor(c->nt, 96) ^ crypto1_word(&c->cs, 0, 0);
+	c->authed = 1;
+	return 0;
+}
+void mfsim_halt(struct mfsim *c)
+{
+	c->authed = c->pending = 0;
+}
@@ -0,0 +1,52 @@
+/*  mfsim.h
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+*/
+#ifndef MFSIM_INCLUDED
+#define MFSIM_INCLUDED
+#include "crapto1.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* In process MIFARE Classic card, just enough of one to be attacked:
+ * the 16 bit nonce generator keeps running between authentications,
+ * nested authentications encrypt nt and its parity bits like the real
+ * thing, and the reader's answer is checked before {at} is sent.
+ * A hardened card draws every nt at random instead.
+ */
+struct mfsim {
+	uint32_t uid;
+	uint64_t key[40][2];
+	/* nt advances by delay + a uniform 0 .. jitter between auths */
+	uint32_t nt, delay, jitter;
+	uint64_t rng;
+	struct Crypto1State cs;
+	int authed, pending, hardened;
+};
+
+#define MFSIM_SECTOR(block) ((block) < 128 ? (block) >> 2 : 24 + ((block) >> 4))
+
+void mfsim_init(struct mfsim*, uint32_t uid, uint64_t seed);
+int mfsim_auth(struct mfsim*, uint8_t block, int keyb, uint32_t *nt,
+	       uint8_t par[4]);
+int mfsim_answer(struct mfsim*, uint32_t nr_enc, uint32_t ar_enc,
+		 uint32_t *at_enc);
+void mfsim_halt(struct mfsim*);
+#ifdef __cplusplus
+}
+#endif
+#endif
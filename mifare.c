@@ -162,8 +162,24 @@ void decrypt_bit( struct Crypto1State* s, uint8_t* pbtRx, const size_t szRxBits,
 
 bool decrypt( struct Crypto1State* s, uint8_t* pbtRx, uint8_t* pbtRxPar, const size_t szRxBytes, bool input, const uint8_t* pbtIx )
 {
+   uint8_t ks, ksPar;
    size_t i;
 
+   if( !input )
+   {
+     // Plain keystream, a byte of state at a time.  The cipher only steps
+     // past a byte once its parity checked, as in the loop below
+     for( i = 0; i < szRxBytes; i++ )
+     {
+	 crypto1_keystream( s, &ks, &ksPar, 1 );
+	 pbtRx[ i ] ^= ks;
+	 pbtRxPar[ i ] ^= ksPar;
+	 if( oddparity( pbtRx[ i ] ) != pbtRxPar[ i ] )
+	   return false;
+     }
+     return true;
+   }
+
    for( i = 0; i < szRxBytes; i++ )
    {
 	 if( input ) decrypt_bit( s, &pbtRx[i], 8, true, pbtIx[i] );
@@ -178,9 +194,21 @@ bool decrypt( struct Crypto1State* s, uint8_t* pbtRx, uint8_t* pbtRxPar, const s
 
 void encrypt( struct Crypto1State* s, uint8_t* pbtTx, uint8_t* pbtTxPar, const size_t szTxBytes, bool input )
 {
-   uint8_t ks;
+   uint8_t ks, ksBytes[MAX_FRAME_LEN];
    size_t i;
 
+   if( !input && szTxBytes <= MAX_FRAME_LEN )
+   {
+     // Plain keystream, a byte of state at a time
+     crypto1_keystream( s, ksBytes, pbtTxPar, szTxBytes );
+     for( i = 0; i < szTxBytes; i++ )
+     {
+	 pbtTxPar[ i ] ^= oddparity( pbtTx[ i ] );
+	 pbtTx[ i ] ^= ksBytes[ i ];
+     }
+     return;
+   }
+
    for( i = 0; i < szTxBytes; i++ )
    {
      if( input ) ks =  crypto1_byte( s, pbtTx[ i ], 0 );
@@ -0,0 +1,118 @@
+/*  nested-sim.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+
+    Run the nested attack end to end against a simulated card: knowing
+    key A of sector 0, recover both keys of the other sectors.
+
+      nested-sim [-n sectors] [-j jitter] [-s seed]
+
+    Build:
+      cc -O2 -o nested-sim nested-sim.c nested.c mfsim.c crapto1.c \
+         crypto1.c -lpthread
+*/
+#include "nested.h"
+#include "mfsim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+static int sim_auth(void *ctx, uint8_t block, int keyb, uint32_t *nt,
+		    uint8_t par[4])
+{
+	return mfsim_auth(ctx, block, keyb, nt, par);
+}
+static int sim_answer(void *ctx, uint32_t nr_enc, uint32_t ar_enc,
+		      uint32_t *at_enc)
+{
+	return mfsim_answer(ctx, nr_enc, ar_enc, at_enc);
+}
+static void sim_halt(void *ctx)
+{
+	mfsim_halt(ctx);
+}
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+	struct mfsim sim;
+	struct nested_card card = {0, sim_auth, sim_answer, sim_halt, &sim};
+	struct nested_dist dist;
+	uint64_t seed = 1, key;
+	int opt, sectors = 16, jitter = 16, sector, keyb, ok = 0, tried = 0;
+	double t;
+
+	while((opt = getopt(argc, argv, "n:j:s:")) != -1)
+		switch(opt) {
+		case 'n':
+			sectors = atoi(optarg);
+			break;
+		case 'j':
+			jitter = atoi(optarg);
+			break;
+		case 's':
+			seed = strtoull(optarg, 0, 0);
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-n sectors] [-j jitter] "
+				"[-s seed]\n", argv[0]);
+			return 1;
+		}
+	if(sectors < 1 || sectors > 40)
+		sectors = 16;
+
+	mfsim_init(&sim, 0x4a7f13c2 ^ (uint32_t)seed, seed);
+	sim.jitter = jitter;
+	card.uid = sim.uid;
+
+	t = now();
+	if(nested_calibrate(&card, 0, 0, sim.key[0][0], 16, &dist)) {
+		fprintf(stderr, "calibration failed\n");
+		return 1;
+	}
+	printf("uid %08x, nonce distance %d..%d\n", sim.uid, dist.min, dist.max);
+
+	for(sector = 0; sector < sectors; ++sector)
+		for(keyb = 0; keyb < 2; ++keyb) {
+			uint8_t block = sector < 32 ? sector * 4 :
+				128 + (sector - 32) * 16;
+
+			if(!sector && !keyb)
+				continue;
+			++tried;
+			if(nested_recover(&card, 0, 0, sim.key[0][0], &dist,
+					  block, keyb, 32, &key)) {
+				printf("sector %2d key %c: not found\n",
+				       sector, "AB"[keyb]);
+				continue;
+			}
+			ok += key == sim.key[sector][keyb];
+			printf("sector %2d key %c: %012llx%s\n", sector, "AB"[keyb],
+			       (unsigned long long)key,
+			       key == sim.key[sector][keyb] ? "" : " WRONG");
+		}
+	t = now() - t;
+	printf("%d/%d keys in %.2fs, %.2f keys/min\n", ok, tried, t,
+	       ok * 60 / t);
+	return ok != tried;
+}
